@@ -0,0 +1,114 @@
+#include "../core/elm_framer/elm_framer.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ITERATIONS 20000U
+#define BENCH_CHUNK_SIZE 20U
+
+typedef struct {
+    const char* name;
+    const char* command;
+    const char* reply;
+    u8 line_count;
+    ElmResponseType_t status;
+    bool corrupted;
+} FramerCase_t;
+
+typedef struct {
+    u32 responses;
+    u8 line_count;
+    ElmResponseType_t status;
+    bool corrupted;
+} FramerResult_t;
+
+static const FramerCase_t cases[] = {
+    { "single frame", "010C", "010C\r41 0C 1A F8\r\r>", 1U, ELM_RESPONSE_DATA, false },
+    { "multi ECU", "0100", "41 00 BE 3F A8 13\r41 00 98 18 80 11\r\r>", 2U, ELM_RESPONSE_DATA, false },
+    { "multi frame VIN", "0902",
+      "0902\r014\r0: 49 02 01 31 44 34\r1: 47 50 30 30 52 35 35\r2: 42 31 32 33 34 35 36\r\r>",
+      4U, ELM_RESPONSE_DATA, false },
+    { "no data", "0146", "NO DATA\r\r>", 1U, ELM_RESPONSE_NO_DATA, false },
+    { "fatal CAN error", "0100", "ERR94\r\r>", 1U, ELM_RESPONSE_FATAL_ERROR, false },
+    { "line noise", "010D", "41 0D 3G\r41 0D 32\r\r>", 1U, ELM_RESPONSE_DATA_ERROR, true },
+    { "colon in data", "010D", "41 0D: 32\r\r>", 0U, ELM_RESPONSE_DATA_ERROR, true }
+};
+
+static void on_response(const ElmFramerResponse_t* response, void* context)
+{
+    FramerResult_t* result = (FramerResult_t*)context;
+    
+    result->responses++;
+    result->line_count = response->line_count;
+    result->status = response->status;
+    result->corrupted = response->corrupted;
+}
+
+static void run_case(ElmFramer_t* framer, const FramerCase_t* test)
+{
+    const u8* reply = (const u8*)test->reply;
+    u16 length = (u16)strlen(test->reply);
+    
+    Result_t result = ElmFramer_OnRequestSent(framer, (const u8*)test->command, (u8)strlen(test->command), 0U);
+    UNUSED(result);
+    
+    for (u16 offset = 0U; offset < length; offset += BENCH_CHUNK_SIZE) {
+        u16 chunk = (u16)(length - offset);
+        
+        if (chunk > BENCH_CHUNK_SIZE) {
+            chunk = BENCH_CHUNK_SIZE;
+        }
+        
+        result = ElmFramer_Feed(framer, &reply[offset], chunk, offset);
+        UNUSED(result);
+    }
+}
+
+int main(void)
+{
+    u32 case_count = (u32)(sizeof(cases) / sizeof(cases[0]));
+    u32 failures = 0U;
+    
+    printf("%-16s %6s %12s %12s\n", "case", "lines", "status", "ns/byte");
+    
+    for (u32 c = 0U; c < case_count; c++) {
+        const FramerCase_t* test = &cases[c];
+        FramerResult_t outcome;
+        ElmFramer_t framer;
+        ElmFramerConfig_t config;
+        
+        memset(&outcome, 0, sizeof(outcome));
+        memset(&config, 0, sizeof(config));
+        config.response_callback = on_response;
+        config.callback_context = &outcome;
+        
+        Result_t result = ElmFramer_Init(&framer, &config);
+        UNUSED(result);
+        
+        run_case(&framer, test);
+        
+        bool passed = (outcome.responses == 1U) &&
+                      (outcome.line_count == test->line_count) &&
+                      (outcome.status == test->status) &&
+                      (outcome.corrupted == test->corrupted);
+        
+        clock_t start = clock();
+        for (u32 i = 0U; i < BENCH_ITERATIONS; i++) {
+            run_case(&framer, test);
+        }
+        clock_t end = clock();
+        
+        double seconds = (double)(end - start) / (double)CLOCKS_PER_SEC;
+        double bytes = (double)BENCH_ITERATIONS * (double)strlen(test->reply);
+        
+        printf("%-16s %6u %12s %12.2f %s\n",
+               test->name, outcome.line_count, ElmResponse_GetTypeString(outcome.status),
+               (seconds * 1.0e9) / bytes, (passed == true) ? "ok" : "FAIL");
+        
+        if (passed == false) {
+            failures++;
+        }
+    }
+    
+    return (failures == 0U) ? 0 : 1;
+}
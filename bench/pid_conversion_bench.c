@@ -0,0 +1,174 @@
+#include "../core/pid/pid_manager.h"
+#include <float.h>
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_ITERATIONS 200000U
+#define BENCH_BATCH_SAMPLES 262144U
+#define BENCH_BATCH_PIDS 13U
+#define BENCH_BATCH_ROUNDS 8U
+
+static volatile float float_sink;
+static volatile i32 fixed_sink;
+
+static double elapsed_ns(clock_t start, clock_t end, u32 samples)
+{
+    double seconds = (double)(end - start) / (double)CLOCKS_PER_SEC;
+    return (seconds * 1.0e9) / (double)samples;
+}
+
+static void fill_raw(u8* raw, u32 iteration)
+{
+    raw[0] = (u8)(iteration * 7U);
+    raw[1] = (u8)(iteration * 13U);
+    raw[2] = (u8)(iteration * 29U);
+    raw[3] = (u8)(iteration * 31U);
+}
+
+static u8 batch_pids[BENCH_BATCH_SAMPLES];
+static u8 batch_raw[BENCH_BATCH_SAMPLES * PID_BATCH_RAW_STRIDE];
+static i32 batch_raw_values[BENCH_BATCH_SAMPLES];
+static float batch_eng[BENCH_BATCH_SAMPLES];
+static float single_eng[BENCH_BATCH_SAMPLES];
+
+static u32 bench_batch(u32 def_count)
+{
+    u32 mismatches = 0U;
+    
+    for (u32 i = 0U; i < BENCH_BATCH_SAMPLES; i++) {
+        u32 k = ((i * 7U) + (i >> 5U)) % BENCH_BATCH_PIDS;
+        batch_pids[i] = PidManager_GetDefinitionAt((k * def_count) / BENCH_BATCH_PIDS)->pid;
+        fill_raw(&batch_raw[i * PID_BATCH_RAW_STRIDE], i);
+    }
+    
+    clock_t start = clock();
+    for (u32 round = 0U; round < BENCH_BATCH_ROUNDS; round++) {
+        for (u32 i = 0U; i < BENCH_BATCH_SAMPLES; i++) {
+            PidValue_t value;
+            Result_t result = PidManager_ConvertRawToEng(batch_pids[i], &batch_raw[i * PID_BATCH_RAW_STRIDE],
+                                                         PID_BATCH_RAW_STRIDE, &value);
+            UNUSED(result);
+            single_eng[i] = value.eng_value;
+        }
+    }
+    clock_t single_end = clock();
+    
+    PidBatchOutput_t output;
+    output.raw_values = batch_raw_values;
+    output.eng_values = batch_eng;
+    output.timestamps_ms = NULL_PTR;
+    
+    Result_t result = RESULT_OK;
+    
+    for (u32 round = 0U; (round < BENCH_BATCH_ROUNDS) && (result == RESULT_OK); round++) {
+        result = PidManager_ConvertBatch(batch_pids, batch_raw, NULL_PTR, BENCH_BATCH_SAMPLES, &output);
+    }
+    clock_t batch_end = clock();
+    
+    if (result != RESULT_OK) {
+        return BENCH_BATCH_SAMPLES;
+    }
+    
+    for (u32 i = 0U; i < BENCH_BATCH_SAMPLES; i++) {
+        if (batch_eng[i] != single_eng[i]) {
+            mismatches++;
+        }
+    }
+    
+    printf("%-16s %12.2f %12.2f %14u %s\n", "batch",
+           elapsed_ns(start, single_end, BENCH_BATCH_SAMPLES * BENCH_BATCH_ROUNDS),
+           elapsed_ns(single_end, batch_end, BENCH_BATCH_SAMPLES * BENCH_BATCH_ROUNDS),
+           mismatches, (mismatches == 0U) ? "ok" : "FAIL");
+    
+    return mismatches;
+}
+
+int main(void)
+{
+    u32 def_count = PidManager_GetDefinitionCount();
+    u32 total_samples = 0U;
+    double total_float_ns = 0.0;
+    double total_fixed_ns = 0.0;
+    u32 failures = 0U;
+    
+    printf("%-16s %12s %12s %14s\n", "PID", "float ns", "fixed ns", "max abs diff");
+    
+    for (u32 d = 0U; d < def_count; d++) {
+        const PidDefinition_t* def = PidManager_GetDefinitionAt(d);
+        u8 raw[4];
+        PidValue_t value;
+        PidFixedValue_t fixed;
+        double max_diff = 0.0;
+        u32 mismatches = 0U;
+        
+        clock_t start = clock();
+        for (u32 i = 0U; i < BENCH_ITERATIONS; i++) {
+            fill_raw(raw, i);
+            Result_t result = PidManager_ConvertRawToEng(def->pid, raw, 4U, &value);
+            UNUSED(result);
+            float_sink = value.eng_value;
+        }
+        clock_t float_end = clock();
+        
+        for (u32 i = 0U; i < BENCH_ITERATIONS; i++) {
+            fill_raw(raw, i);
+            Result_t result = PidManager_ConvertRawToFixed(def->pid, raw, 4U, &fixed);
+            UNUSED(result);
+            fixed_sink = fixed.eng_fixed;
+        }
+        clock_t fixed_end = clock();
+        
+        for (u32 i = 0U; i < 256U; i++) {
+            fill_raw(raw, i);
+            Result_t result = PidManager_ConvertRawToEng(def->pid, raw, 4U, &value);
+            UNUSED(result);
+            result = PidManager_ConvertRawToFixed(def->pid, raw, 4U, &fixed);
+            UNUSED(result);
+            
+            double exact = (double)fixed.eng_fixed / (double)fixed.scale;
+            double diff = (double)value.eng_value - exact;
+            double limit = (exact < 0.0) ? -exact : exact;
+            if (diff < 0.0) {
+                diff = -diff;
+            }
+            if (limit < 1.0) {
+                limit = 1.0;
+            }
+            if (diff > max_diff) {
+                max_diff = diff;
+            }
+            if (diff > (limit * 4.0 * (double)FLT_EPSILON)) {
+                mismatches++;
+            }
+        }
+        
+        double float_ns = elapsed_ns(start, float_end, BENCH_ITERATIONS);
+        double fixed_ns = elapsed_ns(float_end, fixed_end, BENCH_ITERATIONS);
+        
+        total_float_ns += float_ns;
+        total_fixed_ns += fixed_ns;
+        total_samples++;
+        
+        printf("0x%02X %-11s %12.2f %12.2f %14.9f %s\n",
+               def->pid, def->short_name, float_ns, fixed_ns, max_diff,
+               (mismatches == 0U) ? "ok" : "FAIL");
+        
+        if (mismatches > 0U) {
+            failures++;
+        }
+    }
+    
+    if (total_samples > 0U) {
+        printf("%-16s %12.2f %12.2f\n", "mean",
+               total_float_ns / (double)total_samples,
+               total_fixed_ns / (double)total_samples);
+    }
+    
+    printf("%-16s %12s %12s %14s\n", "", "single ns", "batch ns", "mismatches");
+    
+    if (bench_batch(def_count) > 0U) {
+        failures++;
+    }
+    
+    return (failures == 0U) ? 0 : 1;
+}
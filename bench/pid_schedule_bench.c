@@ -0,0 +1,134 @@
+#include "../core/pid/pid_manager.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_DURATION_MS 600000U
+#define BENCH_LINK_MS 40U
+#define BENCH_IDLE_MS 5U
+
+typedef struct {
+    u8 pid;
+    u16 rate_ms;
+} BenchPid_t;
+
+static const BenchPid_t bench_pids[] = {
+    { 0x0C, 100U },
+    { 0x11, 100U },
+    { 0x45, 100U },
+    { 0x49, 100U },
+    { 0x4A, 100U },
+    { 0x04, 250U },
+    { 0x0B, 250U },
+    { 0x0D, 250U },
+    { 0x10, 250U },
+    { 0x05, 1000U },
+    { 0x0F, 1000U },
+    { 0x2F, 1000U },
+    { 0x31, 1000U }
+};
+
+static u32 bench_now_ms;
+
+static u32 bench_time_ms(void)
+{
+    return bench_now_ms;
+}
+
+static void advance(Clock_t* clock, u32 ms)
+{
+    bench_now_ms += ms;
+    Result_t result = Clock_Tick(clock);
+    UNUSED(result);
+}
+
+static u32 run(PidSchedulePolicy_t policy, bool report_sends, PidClassStats_t* stats)
+{
+    static PidManager_t pm;
+    Clock_t clock;
+    ClockConfig_t clock_config;
+    PidManagerConfig_t config;
+    
+    bench_now_ms = 1000U;
+    memset(&clock_config, 0, sizeof(clock_config));
+    clock_config.get_time_ms = bench_time_ms;
+    Result_t result = Clock_Init(&clock, &clock_config);
+    advance(&clock, 0U);
+    
+    memset(&config, 0, sizeof(config));
+    config.clock = &clock;
+    result = PidManager_Init(&pm, &config);
+    result = PidManager_SetSchedulePolicy(&pm, policy);
+    
+    for (u32 i = 0U; i < (u32)(sizeof(bench_pids) / sizeof(bench_pids[0])); i++) {
+        result = PidManager_EnablePid(&pm, bench_pids[i].pid, bench_pids[i].rate_ms);
+    }
+    
+    result = PidManager_ResetClassStats(&pm);
+    
+    u32 end_ms = bench_now_ms + BENCH_DURATION_MS;
+    u32 sent = 0U;
+    
+    while (bench_now_ms < end_ms) {
+        PidRequest_t request;
+        
+        if (PidManager_GetNextRequest(&pm, &request) != RESULT_OK) {
+            advance(&clock, BENCH_IDLE_MS);
+            continue;
+        }
+        
+        if (report_sends == true) {
+            result = PidManager_OnRequestSent(&pm, &request);
+        }
+        
+        advance(&clock, BENCH_LINK_MS);
+        
+        Obd2Frame_t frame;
+        memset(&frame, 0, sizeof(frame));
+        frame.mode = OBD2_MODE_01_LIVE_DATA;
+        frame.pid = (u8)request.did;
+        frame.data[0] = (u8)sent;
+        frame.data[1] = (u8)(sent >> 8U);
+        frame.data[2] = 0x80U;
+        frame.data[3] = 0x00U;
+        frame.data_length = 4U;
+        frame.valid = true;
+        
+        result = PidManager_ProcessFrame(&pm, &frame);
+        sent++;
+    }
+    
+    for (u8 c = 0U; c < PID_PRIORITY_MAX; c++) {
+        result = PidManager_GetClassStats(&pm, c, &stats[c]);
+    }
+    
+    UNUSED(result);
+    return sent;
+}
+
+int main(void)
+{
+    static const char* const policy_names[PID_POLICY_MAX] = { "strict", "fair" };
+    u32 failures = 0U;
+    
+    printf("%-8s %-10s %8s %10s %10s %10s\n", "policy", "sends", "total", "high/min", "med/min", "low/min");
+    
+    for (u8 p = 0U; p < (u8)PID_POLICY_MAX; p++) {
+        for (u8 r = 0U; r < 2U; r++) {
+            PidClassStats_t stats[PID_PRIORITY_MAX];
+            bool report_sends = (r == 1U);
+            u32 total = run((PidSchedulePolicy_t)p, report_sends, stats);
+            
+            printf("%-8s %-10s %8u %10u %10u %10u\n",
+                   policy_names[p], (report_sends == true) ? "reported" : "implicit", total,
+                   stats[PID_PRIORITY_HIGH].requests_per_minute,
+                   stats[PID_PRIORITY_MEDIUM].requests_per_minute,
+                   stats[PID_PRIORITY_LOW].requests_per_minute);
+            
+            if ((p == (u8)PID_POLICY_WEIGHTED_FAIR) && (stats[PID_PRIORITY_LOW].requests_per_minute == 0U)) {
+                failures++;
+            }
+        }
+    }
+    
+    return (failures == 0U) ? 0 : 1;
+}
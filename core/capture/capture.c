@@ -0,0 +1,391 @@
+#include "capture.h"
+
+static const char* const state_strings[] = {
+    [CAPTURE_STATE_IDLE] = "Idle",
+    [CAPTURE_STATE_MONITORING] = "Monitoring",
+    [CAPTURE_STATE_CAPTURING] = "Capturing",
+    [CAPTURE_STATE_COOLDOWN] = "Cooldown"
+};
+
+static void push_pre_sample(Capture_t* cap, const CaptureSample_t* sample)
+{
+    cap->pre_ring[cap->pre_head] = *sample;
+    cap->pre_head = (u16)((cap->pre_head + 1U) % CAPTURE_PRE_RING_DEPTH);
+    
+    if (cap->pre_count < CAPTURE_PRE_RING_DEPTH) {
+        cap->pre_count++;
+    }
+}
+
+static void append_record(Capture_t* cap, const CaptureSample_t* sample)
+{
+    if (cap->record_count < cap->record_capacity) {
+        cap->record_buffer[cap->record_count] = *sample;
+        cap->record_count++;
+    } else {
+        cap->samples_dropped++;
+    }
+}
+
+static bool evaluate_rule(const CaptureRule_t* rule, CaptureRuleState_t* state, const PidValue_t* value)
+{
+    bool condition = false;
+    u32 elapsed = value->timestamp_ms - state->last_timestamp_ms;
+    bool in_window = (state->seen == true) && ((rule->window_ms == 0U) || (elapsed <= rule->window_ms));
+    
+    switch (rule->type) {
+        case CAPTURE_TRIGGER_ABOVE:
+            condition = (value->eng_value > rule->threshold);
+            break;
+            
+        case CAPTURE_TRIGGER_BELOW:
+            condition = (value->eng_value < rule->threshold);
+            break;
+            
+        case CAPTURE_TRIGGER_DROP:
+            condition = (in_window == true) && ((state->last_value - value->eng_value) >= rule->threshold);
+            break;
+            
+        case CAPTURE_TRIGGER_RISE:
+            condition = (in_window == true) && ((value->eng_value - state->last_value) >= rule->threshold);
+            break;
+            
+        case CAPTURE_TRIGGER_BIT_SET:
+            condition = (((u32)value->raw_value & rule->bit_mask) != 0U);
+            break;
+            
+        case CAPTURE_TRIGGER_MAX:
+        default:
+            break;
+    }
+    
+    bool fired = (condition == true) && (state->last_condition == false);
+    
+    state->last_value = value->eng_value;
+    state->last_timestamp_ms = value->timestamp_ms;
+    state->last_condition = condition;
+    state->seen = true;
+    
+    return fired;
+}
+
+static void begin_capture(Capture_t* cap, u8 rule_index, u32 trigger_ms)
+{
+    cap->state = CAPTURE_STATE_CAPTURING;
+    cap->active_rule = rule_index;
+    cap->trigger_ms = trigger_ms;
+    cap->record_count = 0U;
+    
+    u16 start = (u16)((cap->pre_head + CAPTURE_PRE_RING_DEPTH - cap->pre_count) % CAPTURE_PRE_RING_DEPTH);
+    
+    for (u16 i = 0U; i < cap->pre_count; i++) {
+        const CaptureSample_t* sample = &cap->pre_ring[(start + i) % CAPTURE_PRE_RING_DEPTH];
+        
+        if ((trigger_ms - sample->timestamp_ms) <= cap->pre_window_ms) {
+            append_record(cap, sample);
+        }
+    }
+    
+    cap->record_pre_count = cap->record_count;
+    cap->pre_count = 0U;
+    cap->pre_head = 0U;
+    
+    PidManager_SetSubscriptionRate(cap->pid_manager, cap->subscription_id, cap->burst_rate_ms);
+}
+
+static void finish_capture(Capture_t* cap, u32 current_time_ms)
+{
+    PidManager_SetSubscriptionRate(cap->pid_manager, cap->subscription_id, cap->monitor_rate_ms);
+    
+    if (cap->record_callback != NULL_PTR) {
+        CaptureRecord_t record;
+        record.rule_index = cap->active_rule;
+        record.trigger_ms = cap->trigger_ms;
+        record.pre_trigger_count = cap->record_pre_count;
+        record.sample_count = cap->record_count;
+        record.samples = cap->record_buffer;
+        cap->record_callback(&record, cap->callback_context);
+    }
+    
+    cap->captures_completed++;
+    cap->record_count = 0U;
+    cap->cooldown_start_ms = current_time_ms;
+    cap->state = (cap->cooldown_ms > 0U) ? CAPTURE_STATE_COOLDOWN : CAPTURE_STATE_MONITORING;
+}
+
+static void on_value(u8 pid, const PidValue_t* value, void* context)
+{
+    Capture_t* cap = (Capture_t*)context;
+    
+    if ((cap->state == CAPTURE_STATE_IDLE) || (value->valid == false)) {
+        return;
+    }
+    
+    CaptureSample_t sample;
+    sample.timestamp_ms = value->timestamp_ms;
+    sample.pid = pid;
+    sample.value = value->eng_value;
+    
+    bool captured = PidManager_MaskTest(cap->capture_mask, pid);
+    u8 fired_rule = CAPTURE_MAX_RULES;
+    
+    for (u8 i = 0U; i < cap->rule_count; i++) {
+        if ((cap->rules[i].pid == pid) &&
+            (evaluate_rule(&cap->rules[i], &cap->rule_states[i], value) == true) &&
+            (fired_rule == CAPTURE_MAX_RULES)) {
+            fired_rule = i;
+        }
+    }
+    
+    if ((cap->state == CAPTURE_STATE_COOLDOWN) &&
+        ((value->timestamp_ms - cap->cooldown_start_ms) >= cap->cooldown_ms)) {
+        cap->state = CAPTURE_STATE_MONITORING;
+    }
+    
+    switch (cap->state) {
+        case CAPTURE_STATE_MONITORING:
+            if (fired_rule != CAPTURE_MAX_RULES) {
+                begin_capture(cap, fired_rule, value->timestamp_ms);
+                
+                if (captured == true) {
+                    append_record(cap, &sample);
+                }
+            } else if (captured == true) {
+                push_pre_sample(cap, &sample);
+            }
+            break;
+            
+        case CAPTURE_STATE_COOLDOWN:
+            if (captured == true) {
+                push_pre_sample(cap, &sample);
+            }
+            break;
+            
+        case CAPTURE_STATE_CAPTURING:
+            if (captured == true) {
+                append_record(cap, &sample);
+            }
+            
+            if (((value->timestamp_ms - cap->trigger_ms) >= cap->post_window_ms) ||
+                (cap->record_count >= cap->record_capacity)) {
+                finish_capture(cap, value->timestamp_ms);
+            }
+            break;
+            
+        case CAPTURE_STATE_IDLE:
+        case CAPTURE_STATE_MAX:
+        default:
+            break;
+    }
+}
+
+Result_t Capture_Init(Capture_t* cap, const CaptureConfig_t* config)
+{
+    if (cap == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (config == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if ((config->pid_manager == NULL_PTR) || (config->record_buffer == NULL_PTR) ||
+        (config->record_capacity == 0U)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if ((config->rule_count > CAPTURE_MAX_RULES) ||
+        ((config->rule_count > 0U) && (config->rules == NULL_PTR))) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    cap->pid_manager = config->pid_manager;
+    cap->rules = config->rules;
+    cap->rule_count = config->rule_count;
+    
+    for (u8 i = 0U; i < PID_MASK_BYTES; i++) {
+        cap->capture_mask[i] = config->capture_mask[i];
+    }
+    
+    for (u8 i = 0U; i < CAPTURE_MAX_RULES; i++) {
+        cap->rule_states[i].last_value = 0.0f;
+        cap->rule_states[i].last_timestamp_ms = 0U;
+        cap->rule_states[i].last_condition = false;
+        cap->rule_states[i].seen = false;
+    }
+    
+    cap->monitor_rate_ms = (config->monitor_rate_ms > 0U) ? config->monitor_rate_ms : CAPTURE_DEFAULT_MONITOR_RATE_MS;
+    cap->burst_rate_ms = (config->burst_rate_ms > 0U) ? config->burst_rate_ms : CAPTURE_DEFAULT_BURST_RATE_MS;
+    cap->pre_window_ms = (config->pre_window_ms > 0U) ? config->pre_window_ms : CAPTURE_DEFAULT_PRE_WINDOW_MS;
+    cap->post_window_ms = (config->post_window_ms > 0U) ? config->post_window_ms : CAPTURE_DEFAULT_POST_WINDOW_MS;
+    cap->cooldown_ms = config->cooldown_ms;
+    
+    cap->pre_head = 0U;
+    cap->pre_count = 0U;
+    cap->record_buffer = config->record_buffer;
+    cap->record_capacity = config->record_capacity;
+    cap->record_count = 0U;
+    cap->record_pre_count = 0U;
+    cap->active_rule = 0U;
+    cap->trigger_ms = 0U;
+    cap->cooldown_start_ms = 0U;
+    cap->subscription_id = PID_MAX_SUBSCRIBERS;
+    cap->trigger_subscription_id = PID_MAX_SUBSCRIBERS;
+    cap->state = CAPTURE_STATE_IDLE;
+    cap->captures_completed = 0U;
+    cap->samples_dropped = 0U;
+    cap->record_callback = config->record_callback;
+    cap->callback_context = config->callback_context;
+    cap->error_handler = config->error_handler;
+    cap->initialized = true;
+    
+    return RESULT_OK;
+}
+
+Result_t Capture_Start(Capture_t* cap)
+{
+    if (cap == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (cap->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (cap->state != CAPTURE_STATE_IDLE) {
+        return RESULT_BUSY;
+    }
+    
+    u8 trigger_mask[PID_MASK_BYTES];
+    bool has_triggers = false;
+    
+    for (u8 i = 0U; i < PID_MASK_BYTES; i++) {
+        trigger_mask[i] = 0U;
+    }
+    
+    for (u8 i = 0U; i < cap->rule_count; i++) {
+        if (PidManager_MaskTest(cap->capture_mask, cap->rules[i].pid) == false) {
+            PidManager_MaskSet(trigger_mask, cap->rules[i].pid);
+            has_triggers = true;
+        }
+    }
+    
+    Result_t result = PidManager_Subscribe(cap->pid_manager, cap->capture_mask, cap->monitor_rate_ms,
+                                           on_value, cap, &cap->subscription_id);
+    
+    if (result != RESULT_OK) {
+        return result;
+    }
+    
+    if (has_triggers == true) {
+        result = PidManager_Subscribe(cap->pid_manager, trigger_mask, cap->monitor_rate_ms,
+                                      on_value, cap, &cap->trigger_subscription_id);
+        
+        if (result != RESULT_OK) {
+            PidManager_Unsubscribe(cap->pid_manager, cap->subscription_id);
+            cap->subscription_id = PID_MAX_SUBSCRIBERS;
+            return result;
+        }
+    }
+    
+    cap->pre_head = 0U;
+    cap->pre_count = 0U;
+    cap->state = CAPTURE_STATE_MONITORING;
+    
+    return RESULT_OK;
+}
+
+Result_t Capture_Stop(Capture_t* cap)
+{
+    if (cap == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (cap->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (cap->state == CAPTURE_STATE_IDLE) {
+        return RESULT_OK;
+    }
+    
+    PidManager_Unsubscribe(cap->pid_manager, cap->subscription_id);
+    cap->subscription_id = PID_MAX_SUBSCRIBERS;
+    
+    if (cap->trigger_subscription_id < PID_MAX_SUBSCRIBERS) {
+        PidManager_Unsubscribe(cap->pid_manager, cap->trigger_subscription_id);
+        cap->trigger_subscription_id = PID_MAX_SUBSCRIBERS;
+    }
+    cap->state = CAPTURE_STATE_IDLE;
+    
+    return RESULT_OK;
+}
+
+Result_t Capture_Update(Capture_t* cap, u32 current_time_ms)
+{
+    if (cap == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (cap->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if ((cap->state == CAPTURE_STATE_CAPTURING) &&
+        ((current_time_ms - cap->trigger_ms) >= cap->post_window_ms)) {
+        finish_capture(cap, current_time_ms);
+    }
+    
+    if ((cap->state == CAPTURE_STATE_COOLDOWN) &&
+        ((current_time_ms - cap->cooldown_start_ms) >= cap->cooldown_ms)) {
+        cap->state = CAPTURE_STATE_MONITORING;
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t Capture_ForceTrigger(Capture_t* cap, u32 current_time_ms)
+{
+    if (cap == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (cap->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (cap->state != CAPTURE_STATE_MONITORING) {
+        return RESULT_BUSY;
+    }
+    
+    begin_capture(cap, CAPTURE_MAX_RULES, current_time_ms);
+    
+    return RESULT_OK;
+}
+
+CaptureState_t Capture_GetState(const Capture_t* cap)
+{
+    if (cap == NULL_PTR) {
+        return CAPTURE_STATE_IDLE;
+    }
+    
+    return cap->state;
+}
+
+u32 Capture_GetCompletedCount(const Capture_t* cap)
+{
+    if (cap == NULL_PTR) {
+        return 0U;
+    }
+    
+    return cap->captures_completed;
+}
+
+const char* Capture_GetStateString(CaptureState_t state)
+{
+    if (state >= CAPTURE_STATE_MAX) {
+        return "Unknown";
+    }
+    
+    return state_strings[state];
+}
@@ -0,0 +1,128 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include "../types.h"
+#include "../pid/pid_manager.h"
+#include "../error/error_handler.h"
+
+#define CAPTURE_MAX_RULES 8
+#define CAPTURE_PRE_RING_DEPTH 128
+#define CAPTURE_DEFAULT_MONITOR_RATE_MS 1000
+#define CAPTURE_DEFAULT_BURST_RATE_MS 20
+#define CAPTURE_DEFAULT_PRE_WINDOW_MS 5000
+#define CAPTURE_DEFAULT_POST_WINDOW_MS 5000
+
+typedef enum {
+    CAPTURE_STATE_IDLE = 0,
+    CAPTURE_STATE_MONITORING = 1,
+    CAPTURE_STATE_CAPTURING = 2,
+    CAPTURE_STATE_COOLDOWN = 3,
+    CAPTURE_STATE_MAX
+} CaptureState_t;
+
+typedef enum {
+    CAPTURE_TRIGGER_ABOVE = 0,
+    CAPTURE_TRIGGER_BELOW = 1,
+    CAPTURE_TRIGGER_DROP = 2,
+    CAPTURE_TRIGGER_RISE = 3,
+    CAPTURE_TRIGGER_BIT_SET = 4,
+    CAPTURE_TRIGGER_MAX
+} CaptureTriggerType_t;
+
+typedef struct {
+    u8 pid;
+    CaptureTriggerType_t type;
+    float threshold;
+    u32 bit_mask;
+    u16 window_ms;
+} CaptureRule_t;
+
+typedef struct {
+    float last_value;
+    u32 last_timestamp_ms;
+    bool last_condition;
+    bool seen;
+} CaptureRuleState_t;
+
+typedef struct {
+    u32 timestamp_ms;
+    u8 pid;
+    float value;
+} CaptureSample_t;
+
+typedef struct {
+    u8 rule_index;
+    u32 trigger_ms;
+    u16 pre_trigger_count;
+    u16 sample_count;
+    const CaptureSample_t* samples;
+} CaptureRecord_t;
+
+typedef void (*CaptureRecordCallback_t)(const CaptureRecord_t* record, void* context);
+
+typedef struct {
+    ErrorHandler_t* error_handler;
+    PidManager_t* pid_manager;
+    u8 capture_mask[PID_MASK_BYTES];
+    const CaptureRule_t* rules;
+    u8 rule_count;
+    u16 monitor_rate_ms;
+    u16 burst_rate_ms;
+    u32 pre_window_ms;
+    u32 post_window_ms;
+    u32 cooldown_ms;
+    CaptureSample_t* record_buffer;
+    u16 record_capacity;
+    CaptureRecordCallback_t record_callback;
+    void* callback_context;
+} CaptureConfig_t;
+
+typedef struct {
+    PidManager_t* pid_manager;
+    u8 capture_mask[PID_MASK_BYTES];
+    const CaptureRule_t* rules;
+    CaptureRuleState_t rule_states[CAPTURE_MAX_RULES];
+    u8 rule_count;
+    u16 monitor_rate_ms;
+    u16 burst_rate_ms;
+    u32 pre_window_ms;
+    u32 post_window_ms;
+    u32 cooldown_ms;
+    CaptureSample_t pre_ring[CAPTURE_PRE_RING_DEPTH];
+    u16 pre_head;
+    u16 pre_count;
+    CaptureSample_t* record_buffer;
+    u16 record_capacity;
+    u16 record_count;
+    u16 record_pre_count;
+    u8 active_rule;
+    u32 trigger_ms;
+    u32 cooldown_start_ms;
+    u8 subscription_id;
+    u8 trigger_subscription_id;
+    CaptureState_t state;
+    u32 captures_completed;
+    u32 samples_dropped;
+    CaptureRecordCallback_t record_callback;
+    void* callback_context;
+    bool initialized;
+    ErrorHandler_t* error_handler;
+} Capture_t;
+
+Result_t Capture_Init(Capture_t* cap, const CaptureConfig_t* config);
+
+Result_t Capture_Start(Capture_t* cap);
+
+Result_t Capture_Stop(Capture_t* cap);
+
+Result_t Capture_Update(Capture_t* cap, u32 current_time_ms);
+
+Result_t Capture_ForceTrigger(Capture_t* cap, u32 current_time_ms);
+
+CaptureState_t Capture_GetState(const Capture_t* cap);
+
+u32 Capture_GetCompletedCount(const Capture_t* cap);
+
+const char* Capture_GetStateString(CaptureState_t state);
+
+#endif
@@ -0,0 +1,154 @@
+#include "clock.h"
+
+static void publish_tick(Clock_t* clock, u64 now_us)
+{
+    if (now_us > clock->tick.now_us) {
+        clock->tick.now_us = now_us;
+    }
+    
+    clock->tick.now_ms = CLOCK_US_TO_MS(clock->tick.now_us);
+}
+
+Result_t Clock_Init(Clock_t* clock, const ClockConfig_t* config)
+{
+    if (clock == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (config == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    clock->get_time_us = config->get_time_us;
+    clock->get_time_ms = config->get_time_ms;
+    clock->last_source_us = 0U;
+    clock->last_source_ms = 0U;
+    clock->tick.now_us = 0U;
+    clock->tick.now_ms = 0U;
+    
+    if (clock->get_time_us != NULL_PTR) {
+        clock->last_source_us = clock->get_time_us();
+        clock->tick.now_us = clock->last_source_us;
+    } else if (clock->get_time_ms != NULL_PTR) {
+        clock->last_source_ms = clock->get_time_ms();
+    }
+    
+    clock->tick.now_ms = CLOCK_US_TO_MS(clock->tick.now_us);
+    clock->initialized = true;
+    
+    return RESULT_OK;
+}
+
+Result_t Clock_Tick(Clock_t* clock)
+{
+    if (clock == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (clock->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    u64 now_us = clock->tick.now_us;
+    
+    if (clock->get_time_us != NULL_PTR) {
+        clock->last_source_us = clock->get_time_us();
+        now_us = clock->last_source_us;
+    } else if (clock->get_time_ms != NULL_PTR) {
+        u32 source_ms = clock->get_time_ms();
+        now_us += CLOCK_MS_TO_US(source_ms - clock->last_source_ms);
+        clock->last_source_ms = source_ms;
+    } else {
+        return RESULT_NOT_READY;
+    }
+    
+    publish_tick(clock, now_us);
+    
+    return RESULT_OK;
+}
+
+Result_t Clock_Advance(Clock_t* clock, u64 now_us)
+{
+    if (clock == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (clock->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    publish_tick(clock, now_us);
+    
+    return RESULT_OK;
+}
+
+const ClockTick_t* Clock_GetTick(const Clock_t* clock)
+{
+    if (clock == NULL_PTR) {
+        return NULL_PTR;
+    }
+    
+    return &clock->tick;
+}
+
+u64 Clock_NowUs(const Clock_t* clock)
+{
+    if (clock == NULL_PTR) {
+        return 0U;
+    }
+    
+    return clock->tick.now_us;
+}
+
+u32 Clock_NowMs(const Clock_t* clock)
+{
+    if (clock == NULL_PTR) {
+        return 0U;
+    }
+    
+    return clock->tick.now_ms;
+}
+
+u64 Clock_SampleUs(const Clock_t* clock)
+{
+    if (clock == NULL_PTR) {
+        return 0U;
+    }
+    
+    if (clock->initialized == false) {
+        return 0U;
+    }
+    
+    u64 now_us = clock->tick.now_us;
+    u64 sample_us = now_us;
+    
+    if (clock->get_time_us != NULL_PTR) {
+        sample_us = clock->get_time_us();
+    } else if (clock->get_time_ms != NULL_PTR) {
+        sample_us = now_us + CLOCK_MS_TO_US(clock->get_time_ms() - clock->last_source_ms);
+    }
+    
+    return (sample_us > now_us) ? sample_us : now_us;
+}
+
+u64 Clock_ElapsedUs(const Clock_t* clock, u64 since_us)
+{
+    u64 now_us = Clock_NowUs(clock);
+    
+    if (now_us <= since_us) {
+        return 0U;
+    }
+    
+    return now_us - since_us;
+}
+
+u32 Clock_ElapsedMs(const Clock_t* clock, u64 since_us)
+{
+    u64 elapsed_ms = Clock_ElapsedUs(clock, since_us) / CLOCK_US_PER_MS;
+    
+    if (elapsed_ms > 0xFFFFFFFFU) {
+        return 0xFFFFFFFFU;
+    }
+    
+    return (u32)elapsed_ms;
+}
@@ -0,0 +1,47 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include "../types.h"
+
+#define CLOCK_US_PER_MS 1000U
+#define CLOCK_MS_TO_US(ms) ((u64)(ms) * CLOCK_US_PER_MS)
+#define CLOCK_US_TO_MS(us) ((u32)((us) / CLOCK_US_PER_MS))
+
+typedef struct {
+    u64 now_us;
+    u32 now_ms;
+} ClockTick_t;
+
+typedef struct {
+    u64 (*get_time_us)(void);
+    u32 (*get_time_ms)(void);
+} ClockConfig_t;
+
+typedef struct {
+    ClockTick_t tick;
+    u64 (*get_time_us)(void);
+    u32 (*get_time_ms)(void);
+    u64 last_source_us;
+    u32 last_source_ms;
+    bool initialized;
+} Clock_t;
+
+Result_t Clock_Init(Clock_t* clock, const ClockConfig_t* config);
+
+Result_t Clock_Tick(Clock_t* clock);
+
+Result_t Clock_Advance(Clock_t* clock, u64 now_us);
+
+const ClockTick_t* Clock_GetTick(const Clock_t* clock);
+
+u64 Clock_NowUs(const Clock_t* clock);
+
+u32 Clock_NowMs(const Clock_t* clock);
+
+u64 Clock_SampleUs(const Clock_t* clock);
+
+u64 Clock_ElapsedUs(const Clock_t* clock, u64 since_us);
+
+u32 Clock_ElapsedMs(const Clock_t* clock, u64 since_us);
+
+#endif
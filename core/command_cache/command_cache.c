@@ -0,0 +1,208 @@
+#include "command_cache.h"
+
+static const u8 hex_digits[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7',
+    '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+};
+
+static void append_hex_byte(CommandString_t* command, u8 value)
+{
+    command->bytes[command->length] = hex_digits[(value >> 4U) & 0x0FU];
+    command->bytes[command->length + 1U] = hex_digits[value & 0x0FU];
+    command->length += 2U;
+}
+
+static void finish_command(CommandString_t* command)
+{
+    command->bytes[command->length] = '\r';
+    command->length++;
+}
+
+static void build_request_command(const PidRequest_t* request, CommandString_t* command)
+{
+    command->length = 0U;
+    append_hex_byte(command, request->mode);
+    
+    if (request->mode == PID_MODE_LIVE_DATA) {
+        append_hex_byte(command, (u8)request->did);
+    } else {
+        append_hex_byte(command, (u8)(request->did >> 8U));
+        append_hex_byte(command, (u8)(request->did & 0xFFU));
+    }
+    
+    finish_command(command);
+}
+
+static Result_t rebuild(CommandCache_t* cache)
+{
+    PidScheduledRequest_t scheduled[CMD_CACHE_MAX_ENTRIES];
+    u8 scheduled_count = 0U;
+    
+    Result_t result = PidManager_GetScheduledRequests(cache->pid_manager, scheduled,
+                                                      CMD_CACHE_MAX_ENTRIES, &scheduled_count);
+    
+    if ((result != RESULT_OK) && (result != RESULT_BUFFER_FULL)) {
+        return result;
+    }
+    
+    for (u16 i = 0U; i < 256U; i++) {
+        cache->live_index[i] = CMD_CACHE_NO_ENTRY;
+    }
+    
+    cache->entry_count = 0U;
+    
+    for (u8 i = 0U; i < scheduled_count; i++) {
+        CommandCacheEntry_t* entry = &cache->entries[cache->entry_count];
+        
+        entry->request = scheduled[i].request;
+        entry->rate_ms = scheduled[i].rate_ms;
+        build_request_command(&entry->request, &entry->command);
+        
+        if ((entry->request.mode == PID_MODE_LIVE_DATA) && (entry->request.ecu_header == 0U)) {
+            cache->live_index[entry->request.did & 0xFFU] = cache->entry_count;
+        }
+        
+        cache->entry_count++;
+    }
+    
+    cache->generation = PidManager_GetScheduleGeneration(cache->pid_manager);
+    cache->rebuild_count++;
+    cache->built = true;
+    
+    return result;
+}
+
+static const CommandCacheEntry_t* find_entry(const CommandCache_t* cache, const PidRequest_t* request)
+{
+    if ((request->mode == PID_MODE_LIVE_DATA) && (request->ecu_header == 0U)) {
+        if (request->did > 0xFFU) {
+            return NULL_PTR;
+        }
+        
+        u8 index = cache->live_index[request->did];
+        return (index == CMD_CACHE_NO_ENTRY) ? NULL_PTR : &cache->entries[index];
+    }
+    
+    for (u8 i = 0U; i < cache->entry_count; i++) {
+        const PidRequest_t* cached = &cache->entries[i].request;
+        
+        if ((cached->mode == request->mode) && (cached->did == request->did) &&
+            (cached->ecu_header == request->ecu_header)) {
+            return &cache->entries[i];
+        }
+    }
+    
+    return NULL_PTR;
+}
+
+Result_t CommandCache_Init(CommandCache_t* cache, const CommandCacheConfig_t* config)
+{
+    if (cache == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (config == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (config->pid_manager == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    cache->pid_manager = config->pid_manager;
+    
+    for (u16 i = 0U; i < 256U; i++) {
+        cache->live_index[i] = CMD_CACHE_NO_ENTRY;
+    }
+    
+    cache->entry_count = 0U;
+    cache->generation = 0U;
+    cache->rebuild_count = 0U;
+    cache->built = false;
+    cache->initialized = true;
+    
+    return RESULT_OK;
+}
+
+Result_t CommandCache_Refresh(CommandCache_t* cache)
+{
+    if (cache == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (cache->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if ((cache->built == true) &&
+        (cache->generation == PidManager_GetScheduleGeneration(cache->pid_manager))) {
+        return RESULT_OK;
+    }
+    
+    return rebuild(cache);
+}
+
+Result_t CommandCache_Invalidate(CommandCache_t* cache)
+{
+    if (cache == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (cache->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    cache->built = false;
+    
+    return RESULT_OK;
+}
+
+Result_t CommandCache_GetCommand(const CommandCache_t* cache,
+                                 const PidRequest_t* request,
+                                 const u8** bytes,
+                                 u8* length)
+{
+    if (cache == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (request == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (bytes == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (length == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (cache->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (cache->built == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    const CommandCacheEntry_t* entry = find_entry(cache, request);
+    
+    if (entry == NULL_PTR) {
+        return RESULT_NO_DATA;
+    }
+    
+    *bytes = entry->command.bytes;
+    *length = entry->command.length;
+    
+    return RESULT_OK;
+}
+
+u32 CommandCache_GetRebuildCount(const CommandCache_t* cache)
+{
+    if (cache == NULL_PTR) {
+        return 0U;
+    }
+    
+    return cache->rebuild_count;
+}
@@ -0,0 +1,50 @@
+#ifndef COMMAND_CACHE_H
+#define COMMAND_CACHE_H
+
+#include "../types.h"
+#include "../pid/pid_manager.h"
+
+#define CMD_CACHE_MAX_COMMAND 16
+#define CMD_CACHE_MAX_ENTRIES (PID_MAX_ENTRIES + PID_MAX_ENHANCED)
+#define CMD_CACHE_NO_ENTRY 0xFF
+
+typedef struct {
+    u8 bytes[CMD_CACHE_MAX_COMMAND];
+    u8 length;
+} CommandString_t;
+
+typedef struct {
+    PidRequest_t request;
+    u16 rate_ms;
+    CommandString_t command;
+} CommandCacheEntry_t;
+
+typedef struct {
+    const PidManager_t* pid_manager;
+} CommandCacheConfig_t;
+
+typedef struct {
+    CommandCacheEntry_t entries[CMD_CACHE_MAX_ENTRIES];
+    u8 entry_count;
+    u8 live_index[256];
+    const PidManager_t* pid_manager;
+    u32 generation;
+    u32 rebuild_count;
+    bool built;
+    bool initialized;
+} CommandCache_t;
+
+Result_t CommandCache_Init(CommandCache_t* cache, const CommandCacheConfig_t* config);
+
+Result_t CommandCache_Refresh(CommandCache_t* cache);
+
+Result_t CommandCache_Invalidate(CommandCache_t* cache);
+
+Result_t CommandCache_GetCommand(const CommandCache_t* cache,
+                                 const PidRequest_t* request,
+                                 const u8** bytes,
+                                 u8* length);
+
+u32 CommandCache_GetRebuildCount(const CommandCache_t* cache);
+
+#endif
@@ -0,0 +1,425 @@
+#include "elm_framer.h"
+#include <string.h>
+
+static const char* const state_strings[] = {
+    [ELM_FRAMER_IDLE] = "Idle",
+    [ELM_FRAMER_AWAITING] = "Awaiting",
+    [ELM_FRAMER_RECEIVING] = "Receiving",
+    [ELM_FRAMER_RESYNC] = "Resync"
+};
+
+static bool is_hex_or_space(u8 c)
+{
+    if ((c >= (u8)'0') && (c <= (u8)'9')) {
+        return true;
+    }
+    
+    if ((c >= (u8)'A') && (c <= (u8)'F')) {
+        return true;
+    }
+    
+    return (c == (u8)' ');
+}
+
+static bool is_frame_index(const ElmFramer_t* framer)
+{
+    if (framer->current_length == 0U) {
+        return false;
+    }
+    
+    for (u8 i = 0U; i < framer->current_length; i++) {
+        u8 c = framer->current[i];
+        
+        if ((c == (u8)' ') || (is_hex_or_space(c) == false)) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+static void clear_line(ElmFramer_t* framer)
+{
+    framer->current_length = 0U;
+    framer->current_non_hex = false;
+}
+
+static void clear_response(ElmFramer_t* framer)
+{
+    clear_line(framer);
+    framer->line_count = 0U;
+    framer->rx_time_us = 0U;
+    framer->rx_stamped = false;
+    framer->corrupted = false;
+    framer->resync_to_prompt = false;
+    framer->buffered_bytes = 0U;
+    framer->discarded_bytes = 0U;
+}
+
+static void discard_bytes(ElmFramer_t* framer, u16 count)
+{
+    u32 discarded = (u32)framer->discarded_bytes + count;
+    
+    framer->junk_bytes += count;
+    framer->discarded_bytes = (discarded > 0xFFFFU) ? 0xFFFFU : (u16)discarded;
+}
+
+static void enter_resync(ElmFramer_t* framer, bool to_prompt)
+{
+    discard_bytes(framer, framer->current_length);
+    clear_line(framer);
+    
+    if (to_prompt == true) {
+        framer->corrupted = true;
+    }
+    
+    framer->resync_to_prompt = to_prompt;
+    framer->resync_count++;
+    framer->state = ELM_FRAMER_RESYNC;
+}
+
+static bool is_echo(const ElmFramer_t* framer, u8 length)
+{
+    if ((framer->line_count > 0U) || (framer->command_length == 0U)) {
+        return false;
+    }
+    
+    if (length > framer->command_length) {
+        return false;
+    }
+    
+    return (memcmp(framer->current, framer->command, length) == 0);
+}
+
+static void finish_line(ElmFramer_t* framer)
+{
+    u8 length = framer->current_length;
+    
+    while ((length > 0U) && (framer->current[length - 1U] == (u8)' ')) {
+        length--;
+    }
+    
+    if ((length == 0U) || (is_echo(framer, length) == true)) {
+        clear_line(framer);
+        return;
+    }
+    
+    ElmResponseType_t type = ElmResponse_Classify(framer->current, length);
+    
+    if ((type == ELM_RESPONSE_UNRECOGNIZED) ||
+        ((type == ELM_RESPONSE_DATA) && (framer->current_non_hex == true))) {
+        discard_bytes(framer, length);
+        
+        if (type == ELM_RESPONSE_DATA) {
+            framer->corrupted = true;
+        }
+        
+        clear_line(framer);
+        return;
+    }
+    
+    if (framer->line_count >= ELM_FRAMER_MAX_LINES) {
+        discard_bytes(framer, length);
+        framer->corrupted = true;
+        clear_line(framer);
+        return;
+    }
+    
+    if (framer->rx_stamped == false) {
+        framer->rx_time_us = framer->current_start_us;
+        framer->rx_stamped = true;
+    }
+    
+    ElmFramerLine_t* line = &framer->lines[framer->line_count];
+    memcpy(line->text, framer->current, length);
+    line->length = length;
+    line->type = type;
+    framer->line_count++;
+    
+    clear_line(framer);
+}
+
+static void complete_response(ElmFramer_t* framer)
+{
+    bool solicited = (framer->command_length > 0U);
+    
+    if (framer->state == ELM_FRAMER_RESYNC) {
+        discard_bytes(framer, framer->current_length);
+        clear_line(framer);
+    } else {
+        finish_line(framer);
+    }
+    
+    if ((framer->line_count == 0U) && (framer->corrupted == false) && (solicited == false)) {
+        framer->junk_bytes++;
+        clear_response(framer);
+        framer->state = ELM_FRAMER_IDLE;
+        return;
+    }
+    
+    ElmResponseType_t status = ELM_RESPONSE_EMPTY;
+    
+    for (u8 i = 0U; i < framer->line_count; i++) {
+        ElmResponseType_t type = framer->lines[i].type;
+        
+        if (ElmResponse_IsTerminal(type) == true) {
+            status = type;
+            break;
+        }
+        
+        if (type == ELM_RESPONSE_DATA) {
+            status = ELM_RESPONSE_DATA;
+        }
+    }
+    
+    ElmFramerResponse_t response;
+    response.lines = framer->lines;
+    response.line_count = framer->line_count;
+    response.status = status;
+    response.result = ElmResponse_ToResult(status);
+    response.event = ElmResponse_ToEvent(status);
+    response.request_time_us = framer->request_time_us;
+    response.rx_time_us = framer->rx_time_us;
+    response.solicited = solicited;
+    response.corrupted = framer->corrupted;
+    
+    if ((framer->corrupted == true) &&
+        ((status == ELM_RESPONSE_DATA) || (status == ELM_RESPONSE_EMPTY))) {
+        response.status = ELM_RESPONSE_DATA_ERROR;
+        response.result = RESULT_ERROR;
+        response.event = EVENT_NONE;
+    }
+    
+    framer->response_count++;
+    
+    if (framer->corrupted == true) {
+        framer->corrupted_count++;
+    }
+    
+    if (framer->response_callback != NULL_PTR) {
+        framer->response_callback(&response, framer->callback_context);
+    }
+    
+    clear_response(framer);
+    framer->command_length = 0U;
+    framer->request_time_us = 0U;
+    framer->state = ELM_FRAMER_IDLE;
+}
+
+static void accept_byte(ElmFramer_t* framer, u8 c, u64 arrival_us)
+{
+    if ((c == (u8)'\r') || (c == (u8)'\n')) {
+        finish_line(framer);
+        return;
+    }
+    
+    if ((c < 0x20U) || (c > 0x7EU)) {
+        discard_bytes(framer, 1U);
+        return;
+    }
+    
+    if ((c == (u8)' ') && (framer->current_length == 0U)) {
+        return;
+    }
+    
+    if (framer->discarded_bytes >= framer->max_junk_bytes) {
+        enter_resync(framer, true);
+        discard_bytes(framer, 1U);
+        return;
+    }
+    
+    if (framer->current_length >= ELM_FRAMER_MAX_LINE) {
+        enter_resync(framer, false);
+        discard_bytes(framer, 1U);
+        return;
+    }
+    
+    if (framer->current_length == 0U) {
+        framer->current_start_us = arrival_us;
+    }
+    
+    if ((is_hex_or_space(c) == false) &&
+        ((c != (u8)':') || (is_frame_index(framer) == false))) {
+        framer->current_non_hex = true;
+    }
+    
+    framer->current[framer->current_length] = c;
+    framer->current_length++;
+    framer->buffered_bytes++;
+    framer->state = ELM_FRAMER_RECEIVING;
+}
+
+Result_t ElmFramer_Init(ElmFramer_t* framer, const ElmFramerConfig_t* config)
+{
+    if (framer == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (config == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    clear_response(framer);
+    framer->current_start_us = 0U;
+    framer->command_length = 0U;
+    framer->request_time_us = 0U;
+    framer->junk_bytes = 0U;
+    framer->resync_count = 0U;
+    framer->response_count = 0U;
+    framer->corrupted_count = 0U;
+    framer->state = ELM_FRAMER_IDLE;
+    framer->response_callback = config->response_callback;
+    framer->callback_context = config->callback_context;
+    
+    if (config->max_junk_bytes == 0U) {
+        framer->max_junk_bytes = ELM_FRAMER_DEFAULT_MAX_JUNK;
+    } else {
+        framer->max_junk_bytes = config->max_junk_bytes;
+    }
+    
+    framer->initialized = true;
+    
+    return RESULT_OK;
+}
+
+Result_t ElmFramer_Reset(ElmFramer_t* framer)
+{
+    if (framer == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (framer->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    clear_response(framer);
+    framer->command_length = 0U;
+    framer->request_time_us = 0U;
+    framer->state = ELM_FRAMER_IDLE;
+    
+    return RESULT_OK;
+}
+
+Result_t ElmFramer_OnRequestSent(ElmFramer_t* framer, const u8* command, u8 length, u64 sent_us)
+{
+    if (framer == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (command == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (framer->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if ((framer->state == ELM_FRAMER_RECEIVING) || (framer->state == ELM_FRAMER_RESYNC)) {
+        framer->junk_bytes += framer->buffered_bytes;
+        framer->resync_count++;
+    }
+    
+    clear_response(framer);
+    
+    while ((length > 0U) && ((command[length - 1U] == (u8)'\r') || (command[length - 1U] == (u8)'\n'))) {
+        length--;
+    }
+    
+    if (length > ELM_FRAMER_MAX_COMMAND) {
+        length = ELM_FRAMER_MAX_COMMAND;
+    }
+    
+    memcpy(framer->command, command, length);
+    framer->command_length = length;
+    framer->request_time_us = sent_us;
+    framer->state = ELM_FRAMER_AWAITING;
+    
+    return RESULT_OK;
+}
+
+Result_t ElmFramer_Feed(ElmFramer_t* framer, const u8* data, u16 length, u64 arrival_us)
+{
+    if (framer == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (data == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (framer->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    for (u16 i = 0U; i < length; i++) {
+        u8 c = data[i];
+        
+        if (c == (u8)ELM_FRAMER_PROMPT) {
+            complete_response(framer);
+            continue;
+        }
+        
+        if (framer->state == ELM_FRAMER_RESYNC) {
+            if ((c == (u8)'\r') && (framer->resync_to_prompt == false)) {
+                framer->state = ELM_FRAMER_RECEIVING;
+            } else {
+                discard_bytes(framer, 1U);
+                
+                if (framer->discarded_bytes >= framer->max_junk_bytes) {
+                    framer->resync_to_prompt = true;
+                    framer->corrupted = true;
+                }
+            }
+            continue;
+        }
+        
+        accept_byte(framer, c, arrival_us);
+    }
+    
+    return RESULT_OK;
+}
+
+ElmFramerState_t ElmFramer_GetState(const ElmFramer_t* framer)
+{
+    if (framer == NULL_PTR) {
+        return ELM_FRAMER_IDLE;
+    }
+    
+    return framer->state;
+}
+
+u32 ElmFramer_GetJunkCount(const ElmFramer_t* framer)
+{
+    if (framer == NULL_PTR) {
+        return 0U;
+    }
+    
+    return framer->junk_bytes;
+}
+
+u32 ElmFramer_GetResyncCount(const ElmFramer_t* framer)
+{
+    if (framer == NULL_PTR) {
+        return 0U;
+    }
+    
+    return framer->resync_count;
+}
+
+u32 ElmFramer_GetCorruptedCount(const ElmFramer_t* framer)
+{
+    if (framer == NULL_PTR) {
+        return 0U;
+    }
+    
+    return framer->corrupted_count;
+}
+
+const char* ElmFramer_GetStateString(ElmFramerState_t state)
+{
+    if (state >= ELM_FRAMER_STATE_MAX) {
+        return "Unknown";
+    }
+    
+    return state_strings[state];
+}
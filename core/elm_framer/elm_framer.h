@@ -0,0 +1,92 @@
+#ifndef ELM_FRAMER_H
+#define ELM_FRAMER_H
+
+#include "../types.h"
+#include "../elm_response/elm_response.h"
+
+#define ELM_FRAMER_MAX_LINE 64
+#define ELM_FRAMER_MAX_LINES 8
+#define ELM_FRAMER_MAX_COMMAND 16
+#define ELM_FRAMER_DEFAULT_MAX_JUNK 256
+#define ELM_FRAMER_PROMPT '>'
+
+typedef enum {
+    ELM_FRAMER_IDLE = 0,
+    ELM_FRAMER_AWAITING = 1,
+    ELM_FRAMER_RECEIVING = 2,
+    ELM_FRAMER_RESYNC = 3,
+    ELM_FRAMER_STATE_MAX
+} ElmFramerState_t;
+
+typedef struct {
+    u8 text[ELM_FRAMER_MAX_LINE];
+    u8 length;
+    ElmResponseType_t type;
+} ElmFramerLine_t;
+
+typedef struct {
+    const ElmFramerLine_t* lines;
+    u8 line_count;
+    ElmResponseType_t status;
+    Result_t result;
+    Event_t event;
+    u64 request_time_us;
+    u64 rx_time_us;
+    bool solicited;
+    bool corrupted;
+} ElmFramerResponse_t;
+
+typedef void (*ElmFramerResponseCallback_t)(const ElmFramerResponse_t* response, void* context);
+
+typedef struct {
+    ElmFramerResponseCallback_t response_callback;
+    void* callback_context;
+    u16 max_junk_bytes;
+} ElmFramerConfig_t;
+
+typedef struct {
+    ElmFramerLine_t lines[ELM_FRAMER_MAX_LINES];
+    u8 line_count;
+    u8 current[ELM_FRAMER_MAX_LINE];
+    u8 current_length;
+    bool current_non_hex;
+    u64 current_start_us;
+    u8 command[ELM_FRAMER_MAX_COMMAND];
+    u8 command_length;
+    u64 request_time_us;
+    u64 rx_time_us;
+    bool rx_stamped;
+    bool corrupted;
+    bool resync_to_prompt;
+    u16 buffered_bytes;
+    u16 discarded_bytes;
+    u16 max_junk_bytes;
+    u32 junk_bytes;
+    u32 resync_count;
+    u32 response_count;
+    u32 corrupted_count;
+    ElmFramerState_t state;
+    ElmFramerResponseCallback_t response_callback;
+    void* callback_context;
+    bool initialized;
+} ElmFramer_t;
+
+Result_t ElmFramer_Init(ElmFramer_t* framer, const ElmFramerConfig_t* config);
+
+Result_t ElmFramer_Reset(ElmFramer_t* framer);
+
+Result_t ElmFramer_OnRequestSent(ElmFramer_t* framer, const u8* command, u8 length, u64 sent_us);
+
+Result_t ElmFramer_Feed(ElmFramer_t* framer, const u8* data, u16 length, u64 arrival_us);
+
+ElmFramerState_t ElmFramer_GetState(const ElmFramer_t* framer);
+
+u32 ElmFramer_GetJunkCount(const ElmFramer_t* framer);
+
+u32 ElmFramer_GetResyncCount(const ElmFramer_t* framer);
+
+u32 ElmFramer_GetCorruptedCount(const ElmFramer_t* framer);
+
+const char* ElmFramer_GetStateString(ElmFramerState_t state);
+
+#endif
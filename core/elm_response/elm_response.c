@@ -0,0 +1,245 @@
+#include "elm_response.h"
+#include <string.h>
+
+typedef struct {
+    const char* keyword;
+    u8 keyword_length;
+    Result_t result;
+    Event_t event;
+    bool terminal;
+} ElmResponseInfo_t;
+
+static const ElmResponseInfo_t response_info[] = {
+    [ELM_RESPONSE_EMPTY] = { "", 0U, RESULT_NO_DATA, EVENT_NONE, false },
+    [ELM_RESPONSE_DATA] = { "", 0U, RESULT_OK, EVENT_NONE, false },
+    [ELM_RESPONSE_OK] = { "OK", 2U, RESULT_OK, EVENT_NONE, true },
+    [ELM_RESPONSE_UNKNOWN_COMMAND] = { "?", 1U, RESULT_INVALID_PARAM, EVENT_OPERATION_FAILED, true },
+    [ELM_RESPONSE_NO_DATA] = { "NO DATA", 7U, RESULT_NO_DATA, EVENT_NONE, true },
+    [ELM_RESPONSE_SEARCHING] = { "SEARCHING", 9U, RESULT_OK, EVENT_NONE, false },
+    [ELM_RESPONSE_STOPPED] = { "STOPPED", 7U, RESULT_BUSY, EVENT_OPERATION_FAILED, true },
+    [ELM_RESPONSE_CAN_ERROR] = { "CAN ERROR", 9U, RESULT_ERROR, EVENT_OPERATION_FAILED, true },
+    [ELM_RESPONSE_BUS_INIT_OK] = { "BUS INIT", 8U, RESULT_OK, EVENT_NONE, false },
+    [ELM_RESPONSE_BUS_INIT_ERROR] = { "BUS INIT", 8U, RESULT_ERROR, EVENT_PROTOCOL_FAILED, true },
+    [ELM_RESPONSE_UNABLE_TO_CONNECT] = { "UNABLE TO CONNECT", 17U, RESULT_ERROR, EVENT_PROTOCOL_FAILED, true },
+    [ELM_RESPONSE_BUFFER_FULL] = { "BUFFER FULL", 11U, RESULT_BUFFER_FULL, EVENT_OPERATION_FAILED, true },
+    [ELM_RESPONSE_BUS_BUSY] = { "BUS BUSY", 8U, RESULT_BUSY, EVENT_OPERATION_FAILED, true },
+    [ELM_RESPONSE_BUS_ERROR] = { "BUS ERROR", 9U, RESULT_ERROR, EVENT_OPERATION_FAILED, true },
+    [ELM_RESPONSE_DATA_ERROR] = { "DATA ERROR", 10U, RESULT_ERROR, EVENT_OPERATION_FAILED, true },
+    [ELM_RESPONSE_VERSION] = { "ELM327", 6U, RESULT_OK, EVENT_NONE, true },
+    [ELM_RESPONSE_UNRECOGNIZED] = { "", 0U, RESULT_ERROR, EVENT_NONE, false },
+    [ELM_RESPONSE_FATAL_ERROR] = { "ERR", 3U, RESULT_ERROR, EVENT_PROTOCOL_FAILED, true },
+    [ELM_RESPONSE_ACTIVITY_ALERT] = { "ACT ALERT", 9U, RESULT_NOT_READY, EVENT_ERROR, true },
+    [ELM_RESPONSE_LOW_VOLTAGE_RESET] = { "LV RESET", 8U, RESULT_NOT_READY, EVENT_ERROR, true },
+    [ELM_RESPONSE_LOW_POWER_ALERT] = { "LP ALERT", 8U, RESULT_NOT_READY, EVENT_ERROR, true }
+};
+
+static const char* const type_strings[] = {
+    [ELM_RESPONSE_EMPTY] = "Empty",
+    [ELM_RESPONSE_DATA] = "Data",
+    [ELM_RESPONSE_OK] = "OK",
+    [ELM_RESPONSE_UNKNOWN_COMMAND] = "Unknown Command",
+    [ELM_RESPONSE_NO_DATA] = "No Data",
+    [ELM_RESPONSE_SEARCHING] = "Searching",
+    [ELM_RESPONSE_STOPPED] = "Stopped",
+    [ELM_RESPONSE_CAN_ERROR] = "CAN Error",
+    [ELM_RESPONSE_BUS_INIT_OK] = "Bus Init OK",
+    [ELM_RESPONSE_BUS_INIT_ERROR] = "Bus Init Error",
+    [ELM_RESPONSE_UNABLE_TO_CONNECT] = "Unable To Connect",
+    [ELM_RESPONSE_BUFFER_FULL] = "Buffer Full",
+    [ELM_RESPONSE_BUS_BUSY] = "Bus Busy",
+    [ELM_RESPONSE_BUS_ERROR] = "Bus Error",
+    [ELM_RESPONSE_DATA_ERROR] = "Data Error",
+    [ELM_RESPONSE_VERSION] = "Version",
+    [ELM_RESPONSE_UNRECOGNIZED] = "Unrecognized",
+    [ELM_RESPONSE_FATAL_ERROR] = "Fatal Error",
+    [ELM_RESPONSE_ACTIVITY_ALERT] = "Activity Alert",
+    [ELM_RESPONSE_LOW_VOLTAGE_RESET] = "Low Voltage Reset",
+    [ELM_RESPONSE_LOW_POWER_ALERT] = "Low Power Alert"
+};
+
+static bool has_keyword(const u8* line, u16 length, ElmResponseType_t type)
+{
+    const ElmResponseInfo_t* info = &response_info[type];
+    
+    if (length < info->keyword_length) {
+        return false;
+    }
+    
+    return (memcmp(line, info->keyword, info->keyword_length) == 0);
+}
+
+static bool is_hex_digit(u8 c)
+{
+    return ((c >= (u8)'0') && (c <= (u8)'9')) || ((c >= (u8)'A') && (c <= (u8)'F'));
+}
+
+static ElmResponseType_t classify_bus(const u8* line, u16 length)
+{
+    if (length < 5U) {
+        return ELM_RESPONSE_MAX;
+    }
+    
+    if (line[2] == (u8)'F') {
+        return (has_keyword(line, length, ELM_RESPONSE_BUFFER_FULL) == true) ? ELM_RESPONSE_BUFFER_FULL : ELM_RESPONSE_MAX;
+    }
+    
+    switch (line[4]) {
+        case 'I':
+            if (has_keyword(line, length, ELM_RESPONSE_BUS_INIT_OK) == false) {
+                return ELM_RESPONSE_MAX;
+            }
+            if (line[length - 1U] == (u8)'R') {
+                return ELM_RESPONSE_BUS_INIT_ERROR;
+            }
+            if (line[length - 1U] == (u8)'K') {
+                return ELM_RESPONSE_BUS_INIT_OK;
+            }
+            return ELM_RESPONSE_SEARCHING;
+        case 'B':
+            return (has_keyword(line, length, ELM_RESPONSE_BUS_BUSY) == true) ? ELM_RESPONSE_BUS_BUSY : ELM_RESPONSE_MAX;
+        case 'E':
+            return (has_keyword(line, length, ELM_RESPONSE_BUS_ERROR) == true) ? ELM_RESPONSE_BUS_ERROR : ELM_RESPONSE_MAX;
+        default:
+            return ELM_RESPONSE_MAX;
+    }
+}
+
+static ElmResponseType_t classify_keyword(const u8* line, u16 length)
+{
+    ElmResponseType_t candidate = ELM_RESPONSE_MAX;
+    
+    switch (line[0]) {
+        case 'O':
+            candidate = ELM_RESPONSE_OK;
+            break;
+        case '?':
+            candidate = ELM_RESPONSE_UNKNOWN_COMMAND;
+            break;
+        case 'N':
+            candidate = ELM_RESPONSE_NO_DATA;
+            break;
+        case 'S':
+            if (length > 1U) {
+                candidate = (line[1] == (u8)'E') ? ELM_RESPONSE_SEARCHING : ELM_RESPONSE_STOPPED;
+            }
+            break;
+        case 'C':
+            candidate = ELM_RESPONSE_CAN_ERROR;
+            break;
+        case 'B':
+            return classify_bus(line, length);
+        case 'U':
+            candidate = ELM_RESPONSE_UNABLE_TO_CONNECT;
+            break;
+        case 'D':
+            candidate = ELM_RESPONSE_DATA_ERROR;
+            break;
+        case 'E':
+            if (length > 1U) {
+                candidate = (line[1] == (u8)'R') ? ELM_RESPONSE_FATAL_ERROR : ELM_RESPONSE_VERSION;
+            }
+            break;
+        case 'A':
+            candidate = ELM_RESPONSE_ACTIVITY_ALERT;
+            break;
+        case 'L':
+            if (length > 1U) {
+                candidate = (line[1] == (u8)'V') ? ELM_RESPONSE_LOW_VOLTAGE_RESET : ELM_RESPONSE_LOW_POWER_ALERT;
+            }
+            break;
+        case '<':
+            return ELM_RESPONSE_DATA_ERROR;
+        default:
+            break;
+    }
+    
+    if ((candidate != ELM_RESPONSE_MAX) && (has_keyword(line, length, candidate) == false)) {
+        candidate = ELM_RESPONSE_MAX;
+    }
+    
+    return candidate;
+}
+
+ElmResponseType_t ElmResponse_Classify(const u8* line, u16 length)
+{
+    if (line == NULL_PTR) {
+        return ELM_RESPONSE_EMPTY;
+    }
+    
+    if (length == 0U) {
+        return ELM_RESPONSE_EMPTY;
+    }
+    
+    ElmResponseType_t type = classify_keyword(line, length);
+    
+    if (type != ELM_RESPONSE_MAX) {
+        return type;
+    }
+    
+    if (is_hex_digit(line[0]) == false) {
+        return ELM_RESPONSE_UNRECOGNIZED;
+    }
+    
+    if (line[length - 1U] == (u8)'R') {
+        return ELM_RESPONSE_DATA_ERROR;
+    }
+    
+    return ELM_RESPONSE_DATA;
+}
+
+Result_t ElmResponse_ClassifyLine(const u8* line, u16 length, ElmClassification_t* classification)
+{
+    if (line == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (classification == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    ElmResponseType_t type = ElmResponse_Classify(line, length);
+    const ElmResponseInfo_t* info = &response_info[type];
+    
+    classification->type = type;
+    classification->result = info->result;
+    classification->event = info->event;
+    classification->terminal = info->terminal;
+    
+    return RESULT_OK;
+}
+
+Result_t ElmResponse_ToResult(ElmResponseType_t type)
+{
+    if (type >= ELM_RESPONSE_MAX) {
+        return RESULT_ERROR;
+    }
+    
+    return response_info[type].result;
+}
+
+Event_t ElmResponse_ToEvent(ElmResponseType_t type)
+{
+    if (type >= ELM_RESPONSE_MAX) {
+        return EVENT_NONE;
+    }
+    
+    return response_info[type].event;
+}
+
+bool ElmResponse_IsTerminal(ElmResponseType_t type)
+{
+    if (type >= ELM_RESPONSE_MAX) {
+        return false;
+    }
+    
+    return response_info[type].terminal;
+}
+
+const char* ElmResponse_GetTypeString(ElmResponseType_t type)
+{
+    if (type >= ELM_RESPONSE_MAX) {
+        return "Unknown";
+    }
+    
+    return type_strings[type];
+}
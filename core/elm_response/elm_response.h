@@ -0,0 +1,51 @@
+#ifndef ELM_RESPONSE_H
+#define ELM_RESPONSE_H
+
+#include "../types.h"
+#include "../state_machine/state_machine.h"
+
+typedef enum {
+    ELM_RESPONSE_EMPTY = 0,
+    ELM_RESPONSE_DATA = 1,
+    ELM_RESPONSE_OK = 2,
+    ELM_RESPONSE_UNKNOWN_COMMAND = 3,
+    ELM_RESPONSE_NO_DATA = 4,
+    ELM_RESPONSE_SEARCHING = 5,
+    ELM_RESPONSE_STOPPED = 6,
+    ELM_RESPONSE_CAN_ERROR = 7,
+    ELM_RESPONSE_BUS_INIT_OK = 8,
+    ELM_RESPONSE_BUS_INIT_ERROR = 9,
+    ELM_RESPONSE_UNABLE_TO_CONNECT = 10,
+    ELM_RESPONSE_BUFFER_FULL = 11,
+    ELM_RESPONSE_BUS_BUSY = 12,
+    ELM_RESPONSE_BUS_ERROR = 13,
+    ELM_RESPONSE_DATA_ERROR = 14,
+    ELM_RESPONSE_VERSION = 15,
+    ELM_RESPONSE_UNRECOGNIZED = 16,
+    ELM_RESPONSE_FATAL_ERROR = 17,
+    ELM_RESPONSE_ACTIVITY_ALERT = 18,
+    ELM_RESPONSE_LOW_VOLTAGE_RESET = 19,
+    ELM_RESPONSE_LOW_POWER_ALERT = 20,
+    ELM_RESPONSE_MAX
+} ElmResponseType_t;
+
+typedef struct {
+    ElmResponseType_t type;
+    Result_t result;
+    Event_t event;
+    bool terminal;
+} ElmClassification_t;
+
+ElmResponseType_t ElmResponse_Classify(const u8* line, u16 length);
+
+Result_t ElmResponse_ClassifyLine(const u8* line, u16 length, ElmClassification_t* classification);
+
+Result_t ElmResponse_ToResult(ElmResponseType_t type);
+
+Event_t ElmResponse_ToEvent(ElmResponseType_t type);
+
+bool ElmResponse_IsTerminal(ElmResponseType_t type);
+
+const char* ElmResponse_GetTypeString(ElmResponseType_t type);
+
+#endif
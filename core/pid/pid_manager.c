@@ -1,5 +1,7 @@
 #include "pid_manager.h"
 #include <string.h>
+#include <math.h>
+#include <stdatomic.h>
 
 static const char* const unit_strings[] = {
     [PID_UNIT_NONE] = "",
@@ -19,60 +21,144 @@ static const char* const unit_strings[] = {
     [PID_UNIT_PA] = "Pa",
     [PID_UNIT_MA] = "mA",
     [PID_UNIT_NM] = "Nm",
-    [PID_UNIT_LPH] = "L/h"
+    [PID_UNIT_LPH] = "L/h",
+    [PID_UNIT_KM_PER_L] = "km/L",
+    [PID_UNIT_KW] = "kW"
+};
+
+static const PidComponent_t monitor_status_components[] = {
+    {"MIL_ON", PID_UNIT_NONE, 0, 1, 7, 1, PID_SCALE(1, 1), PID_OFFSET(0)},
+    {"DTC_COUNT", PID_UNIT_COUNT, 0, 1, 0, 7, PID_SCALE(1, 1), PID_OFFSET(0)},
+    {"COMPRESSION_IGN", PID_UNIT_NONE, 1, 1, 3, 1, PID_SCALE(1, 1), PID_OFFSET(0)},
+    {"MONITOR_BITS", PID_UNIT_NONE, 1, 3, 0, 24, PID_SCALE(1, 1), PID_OFFSET(0)}
+};
+
+static const PidComponent_t fuel_system_components[] = {
+    {"FUEL_SYS_1", PID_UNIT_NONE, 0, 1, 0, 8, PID_SCALE(1, 1), PID_OFFSET(0)},
+    {"FUEL_SYS_2", PID_UNIT_NONE, 1, 1, 0, 8, PID_SCALE(1, 1), PID_OFFSET(0)}
+};
+
+static const PidComponent_t o2_voltage_trim_components[] = {
+    {"VOLTAGE", PID_UNIT_VOLTS, 0, 1, 0, 8, PID_SCALE(1, 200), PID_OFFSET(0)},
+    {"STFT", PID_UNIT_PERCENT, 1, 1, 0, 8, PID_SCALE(100, 128), PID_OFFSET(-100)}
+};
+
+static const PidComponent_t o2_lambda_voltage_components[] = {
+    {"LAMBDA", PID_UNIT_RATIO, 0, 2, 0, 16, PID_SCALE(1, 32768), PID_OFFSET(0)},
+    {"VOLTAGE", PID_UNIT_VOLTS, 2, 2, 0, 16, PID_SCALE(1, 8192), PID_OFFSET(0)}
 };
 
 static const PidDefinition_t pid_definitions[] = {
-    {0x00, "PIDs supported [01-20]", "PIDS_A", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, 1, 0, PID_PRIORITY_HIGH, 0},
-    {0x01, "Monitor status", "MIL_STATUS", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, 1, 0, PID_PRIORITY_HIGH, 1000},
-    {0x03, "Fuel system status", "FUEL_SYS", PID_UNIT_NONE, PID_DATA_BITFIELD, 2, 0, 0, 1, 0, PID_PRIORITY_LOW, 5000},
-    {0x04, "Calculated engine load", "ENGINE_LOAD", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, 0.392157f, 0, PID_PRIORITY_HIGH, 250},
-    {0x05, "Engine coolant temp", "COOLANT_TEMP", PID_UNIT_DEGREES_C, PID_DATA_U8, 1, -40, 215, 1, -40, PID_PRIORITY_MEDIUM, 1000},
-    {0x06, "Short term fuel trim Bank 1", "STFT_B1", PID_UNIT_PERCENT, PID_DATA_U8, 1, -100, 99.2f, 0.78125f, -100, PID_PRIORITY_MEDIUM, 500},
-    {0x07, "Long term fuel trim Bank 1", "LTFT_B1", PID_UNIT_PERCENT, PID_DATA_U8, 1, -100, 99.2f, 0.78125f, -100, PID_PRIORITY_LOW, 2000},
-    {0x08, "Short term fuel trim Bank 2", "STFT_B2", PID_UNIT_PERCENT, PID_DATA_U8, 1, -100, 99.2f, 0.78125f, -100, PID_PRIORITY_MEDIUM, 500},
-    {0x09, "Long term fuel trim Bank 2", "LTFT_B2", PID_UNIT_PERCENT, PID_DATA_U8, 1, -100, 99.2f, 0.78125f, -100, PID_PRIORITY_LOW, 2000},
-    {0x0A, "Fuel pressure", "FUEL_PRESS", PID_UNIT_KPA, PID_DATA_U8, 1, 0, 765, 3, 0, PID_PRIORITY_MEDIUM, 1000},
-    {0x0B, "Intake manifold pressure", "MAP", PID_UNIT_KPA, PID_DATA_U8, 1, 0, 255, 1, 0, PID_PRIORITY_HIGH, 250},
-    {0x0C, "Engine RPM", "RPM", PID_UNIT_RPM, PID_DATA_U16, 2, 0, 16383.75f, 0.25f, 0, PID_PRIORITY_HIGH, 100},
-    {0x0D, "Vehicle speed", "SPEED", PID_UNIT_KMH, PID_DATA_U8, 1, 0, 255, 1, 0, PID_PRIORITY_HIGH, 250},
-    {0x0E, "Timing advance", "TIMING_ADV", PID_UNIT_DEGREES, PID_DATA_U8, 1, -64, 63.5f, 0.5f, -64, PID_PRIORITY_MEDIUM, 500},
-    {0x0F, "Intake air temperature", "IAT", PID_UNIT_DEGREES_C, PID_DATA_U8, 1, -40, 215, 1, -40, PID_PRIORITY_MEDIUM, 1000},
-    {0x10, "MAF air flow rate", "MAF", PID_UNIT_GRAMS_SEC, PID_DATA_U16, 2, 0, 655.35f, 0.01f, 0, PID_PRIORITY_HIGH, 250},
-    {0x11, "Throttle position", "TPS", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, 0.392157f, 0, PID_PRIORITY_HIGH, 100},
-    {0x1C, "OBD standards", "OBD_STD", PID_UNIT_NONE, PID_DATA_U8, 1, 0, 255, 1, 0, PID_PRIORITY_LOW, 0},
-    {0x1F, "Run time since engine start", "RUN_TIME", PID_UNIT_SECONDS, PID_DATA_U16, 2, 0, 65535, 1, 0, PID_PRIORITY_LOW, 5000},
-    {0x20, "PIDs supported [21-40]", "PIDS_B", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, 1, 0, PID_PRIORITY_HIGH, 0},
-    {0x21, "Distance with MIL on", "MIL_DIST", PID_UNIT_KM, PID_DATA_U16, 2, 0, 65535, 1, 0, PID_PRIORITY_LOW, 5000},
-    {0x2F, "Fuel tank level", "FUEL_LEVEL", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, 0.392157f, 0, PID_PRIORITY_LOW, 5000},
-    {0x31, "Distance since codes cleared", "CLR_DIST", PID_UNIT_KM, PID_DATA_U16, 2, 0, 65535, 1, 0, PID_PRIORITY_LOW, 5000},
-    {0x33, "Barometric pressure", "BARO", PID_UNIT_KPA, PID_DATA_U8, 1, 0, 255, 1, 0, PID_PRIORITY_LOW, 10000},
-    {0x40, "PIDs supported [41-60]", "PIDS_C", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, 1, 0, PID_PRIORITY_HIGH, 0},
-    {0x42, "Control module voltage", "CTRL_VOLT", PID_UNIT_VOLTS, PID_DATA_U16, 2, 0, 65.535f, 0.001f, 0, PID_PRIORITY_LOW, 5000},
-    {0x43, "Absolute load value", "ABS_LOAD", PID_UNIT_PERCENT, PID_DATA_U16, 2, 0, 25700, 0.392157f, 0, PID_PRIORITY_MEDIUM, 500},
-    {0x44, "Commanded AFR", "CMD_AFR", PID_UNIT_RATIO, PID_DATA_U16, 2, 0, 2, 0.0000305f, 0, PID_PRIORITY_MEDIUM, 500},
-    {0x45, "Relative throttle position", "REL_TPS", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, 0.392157f, 0, PID_PRIORITY_HIGH, 100},
-    {0x46, "Ambient air temperature", "AMB_TEMP", PID_UNIT_DEGREES_C, PID_DATA_U8, 1, -40, 215, 1, -40, PID_PRIORITY_LOW, 10000},
-    {0x47, "Absolute throttle position B", "ABS_TPS_B", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, 0.392157f, 0, PID_PRIORITY_MEDIUM, 250},
-    {0x49, "Accelerator pedal position D", "ACCEL_D", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, 0.392157f, 0, PID_PRIORITY_HIGH, 100},
-    {0x4A, "Accelerator pedal position E", "ACCEL_E", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, 0.392157f, 0, PID_PRIORITY_HIGH, 100},
-    {0x4C, "Commanded throttle actuator", "CMD_THROT", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, 0.392157f, 0, PID_PRIORITY_MEDIUM, 250},
-    {0x4D, "Time run with MIL on", "MIL_TIME", PID_UNIT_MINUTES, PID_DATA_U16, 2, 0, 65535, 1, 0, PID_PRIORITY_LOW, 5000},
-    {0x4E, "Time since codes cleared", "CLR_TIME", PID_UNIT_MINUTES, PID_DATA_U16, 2, 0, 65535, 1, 0, PID_PRIORITY_LOW, 5000},
-    {0x51, "Fuel type", "FUEL_TYPE", PID_UNIT_NONE, PID_DATA_U8, 1, 0, 255, 1, 0, PID_PRIORITY_LOW, 0},
-    {0x5C, "Engine oil temperature", "OIL_TEMP", PID_UNIT_DEGREES_C, PID_DATA_U8, 1, -40, 210, 1, -40, PID_PRIORITY_MEDIUM, 2000},
-    {0x5E, "Engine fuel rate", "FUEL_RATE", PID_UNIT_LPH, PID_DATA_U16, 2, 0, 3276.75f, 0.05f, 0, PID_PRIORITY_MEDIUM, 1000},
-    {0x60, "PIDs supported [61-80]", "PIDS_D", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, 1, 0, PID_PRIORITY_HIGH, 0},
-    {0x62, "Actual engine torque %", "ACT_TORQ", PID_UNIT_PERCENT, PID_DATA_U8, 1, -125, 130, 1, -125, PID_PRIORITY_MEDIUM, 500},
-    {0x63, "Engine reference torque", "REF_TORQ", PID_UNIT_NM, PID_DATA_U16, 2, 0, 65535, 1, 0, PID_PRIORITY_LOW, 0},
-    {0x80, "PIDs supported [81-A0]", "PIDS_E", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, 1, 0, PID_PRIORITY_HIGH, 0},
-    {0xA0, "PIDs supported [A1-C0]", "PIDS_F", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, 1, 0, PID_PRIORITY_HIGH, 0},
-    {0xC0, "PIDs supported [C1-E0]", "PIDS_G", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, 1, 0, PID_PRIORITY_HIGH, 0},
-    {0xFF, NULL, NULL, PID_UNIT_NONE, PID_DATA_U8, 0, 0, 0, 0, 0, PID_PRIORITY_MAX, 0}
+    {0x00, "PIDs supported [01-20]", "PIDS_A", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_HIGH, 0, PID_NO_COMPONENTS},
+    {0x01, "Monitor status", "MIL_STATUS", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_HIGH, 1000, PID_COMPONENTS(monitor_status_components)},
+    {0x03, "Fuel system status", "FUEL_SYS", PID_UNIT_NONE, PID_DATA_BITFIELD, 2, 0, 0, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_LOW, 5000, PID_COMPONENTS(fuel_system_components)},
+    {0x04, "Calculated engine load", "ENGINE_LOAD", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, PID_SCALE(100, 255), PID_OFFSET(0), PID_PRIORITY_HIGH, 250, PID_NO_COMPONENTS},
+    {0x05, "Engine coolant temp", "COOLANT_TEMP", PID_UNIT_DEGREES_C, PID_DATA_U8, 1, -40, 215, PID_SCALE(1, 1), PID_OFFSET(-40), PID_PRIORITY_MEDIUM, 1000, PID_NO_COMPONENTS},
+    {0x06, "Short term fuel trim Bank 1", "STFT_B1", PID_UNIT_PERCENT, PID_DATA_U8, 1, -100, 99.2f, PID_SCALE(100, 128), PID_OFFSET(-100), PID_PRIORITY_MEDIUM, 500, PID_NO_COMPONENTS},
+    {0x07, "Long term fuel trim Bank 1", "LTFT_B1", PID_UNIT_PERCENT, PID_DATA_U8, 1, -100, 99.2f, PID_SCALE(100, 128), PID_OFFSET(-100), PID_PRIORITY_LOW, 2000, PID_NO_COMPONENTS},
+    {0x08, "Short term fuel trim Bank 2", "STFT_B2", PID_UNIT_PERCENT, PID_DATA_U8, 1, -100, 99.2f, PID_SCALE(100, 128), PID_OFFSET(-100), PID_PRIORITY_MEDIUM, 500, PID_NO_COMPONENTS},
+    {0x09, "Long term fuel trim Bank 2", "LTFT_B2", PID_UNIT_PERCENT, PID_DATA_U8, 1, -100, 99.2f, PID_SCALE(100, 128), PID_OFFSET(-100), PID_PRIORITY_LOW, 2000, PID_NO_COMPONENTS},
+    {0x0A, "Fuel pressure", "FUEL_PRESS", PID_UNIT_KPA, PID_DATA_U8, 1, 0, 765, PID_SCALE(3, 1), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_NO_COMPONENTS},
+    {0x0B, "Intake manifold pressure", "MAP", PID_UNIT_KPA, PID_DATA_U8, 1, 0, 255, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_HIGH, 250, PID_NO_COMPONENTS},
+    {0x0C, "Engine RPM", "RPM", PID_UNIT_RPM, PID_DATA_U16, 2, 0, 16383.75f, PID_SCALE(1, 4), PID_OFFSET(0), PID_PRIORITY_HIGH, 100, PID_NO_COMPONENTS},
+    {0x0D, "Vehicle speed", "SPEED", PID_UNIT_KMH, PID_DATA_U8, 1, 0, 255, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_HIGH, 250, PID_NO_COMPONENTS},
+    {0x0E, "Timing advance", "TIMING_ADV", PID_UNIT_DEGREES, PID_DATA_U8, 1, -64, 63.5f, PID_SCALE(1, 2), PID_OFFSET(-64), PID_PRIORITY_MEDIUM, 500, PID_NO_COMPONENTS},
+    {0x0F, "Intake air temperature", "IAT", PID_UNIT_DEGREES_C, PID_DATA_U8, 1, -40, 215, PID_SCALE(1, 1), PID_OFFSET(-40), PID_PRIORITY_MEDIUM, 1000, PID_NO_COMPONENTS},
+    {0x10, "MAF air flow rate", "MAF", PID_UNIT_GRAMS_SEC, PID_DATA_U16, 2, 0, 655.35f, PID_SCALE(1, 100), PID_OFFSET(0), PID_PRIORITY_HIGH, 250, PID_NO_COMPONENTS},
+    {0x11, "Throttle position", "TPS", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, PID_SCALE(100, 255), PID_OFFSET(0), PID_PRIORITY_HIGH, 100, PID_NO_COMPONENTS},
+    {0x14, "O2 sensor 1 voltage", "O2S1_V", PID_UNIT_VOLTS, PID_DATA_U8, 2, 0, 1.275f, PID_SCALE(1, 200), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_voltage_trim_components)},
+    {0x15, "O2 sensor 2 voltage", "O2S2_V", PID_UNIT_VOLTS, PID_DATA_U8, 2, 0, 1.275f, PID_SCALE(1, 200), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_voltage_trim_components)},
+    {0x16, "O2 sensor 3 voltage", "O2S3_V", PID_UNIT_VOLTS, PID_DATA_U8, 2, 0, 1.275f, PID_SCALE(1, 200), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_voltage_trim_components)},
+    {0x17, "O2 sensor 4 voltage", "O2S4_V", PID_UNIT_VOLTS, PID_DATA_U8, 2, 0, 1.275f, PID_SCALE(1, 200), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_voltage_trim_components)},
+    {0x18, "O2 sensor 5 voltage", "O2S5_V", PID_UNIT_VOLTS, PID_DATA_U8, 2, 0, 1.275f, PID_SCALE(1, 200), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_voltage_trim_components)},
+    {0x19, "O2 sensor 6 voltage", "O2S6_V", PID_UNIT_VOLTS, PID_DATA_U8, 2, 0, 1.275f, PID_SCALE(1, 200), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_voltage_trim_components)},
+    {0x1A, "O2 sensor 7 voltage", "O2S7_V", PID_UNIT_VOLTS, PID_DATA_U8, 2, 0, 1.275f, PID_SCALE(1, 200), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_voltage_trim_components)},
+    {0x1B, "O2 sensor 8 voltage", "O2S8_V", PID_UNIT_VOLTS, PID_DATA_U8, 2, 0, 1.275f, PID_SCALE(1, 200), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_voltage_trim_components)},
+    {0x1C, "OBD standards", "OBD_STD", PID_UNIT_NONE, PID_DATA_U8, 1, 0, 255, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_LOW, 0, PID_NO_COMPONENTS},
+    {0x1F, "Run time since engine start", "RUN_TIME", PID_UNIT_SECONDS, PID_DATA_U16, 2, 0, 65535, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_LOW, 5000, PID_NO_COMPONENTS},
+    {0x20, "PIDs supported [21-40]", "PIDS_B", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_HIGH, 0, PID_NO_COMPONENTS},
+    {0x21, "Distance with MIL on", "MIL_DIST", PID_UNIT_KM, PID_DATA_U16, 2, 0, 65535, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_LOW, 5000, PID_NO_COMPONENTS},
+    {0x24, "O2 sensor 1 lambda", "O2S1_LAMBDA", PID_UNIT_RATIO, PID_DATA_U16, 4, 0, 2, PID_SCALE(1, 32768), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_lambda_voltage_components)},
+    {0x25, "O2 sensor 2 lambda", "O2S2_LAMBDA", PID_UNIT_RATIO, PID_DATA_U16, 4, 0, 2, PID_SCALE(1, 32768), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_lambda_voltage_components)},
+    {0x26, "O2 sensor 3 lambda", "O2S3_LAMBDA", PID_UNIT_RATIO, PID_DATA_U16, 4, 0, 2, PID_SCALE(1, 32768), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_lambda_voltage_components)},
+    {0x27, "O2 sensor 4 lambda", "O2S4_LAMBDA", PID_UNIT_RATIO, PID_DATA_U16, 4, 0, 2, PID_SCALE(1, 32768), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_lambda_voltage_components)},
+    {0x28, "O2 sensor 5 lambda", "O2S5_LAMBDA", PID_UNIT_RATIO, PID_DATA_U16, 4, 0, 2, PID_SCALE(1, 32768), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_lambda_voltage_components)},
+    {0x29, "O2 sensor 6 lambda", "O2S6_LAMBDA", PID_UNIT_RATIO, PID_DATA_U16, 4, 0, 2, PID_SCALE(1, 32768), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_lambda_voltage_components)},
+    {0x2A, "O2 sensor 7 lambda", "O2S7_LAMBDA", PID_UNIT_RATIO, PID_DATA_U16, 4, 0, 2, PID_SCALE(1, 32768), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_lambda_voltage_components)},
+    {0x2B, "O2 sensor 8 lambda", "O2S8_LAMBDA", PID_UNIT_RATIO, PID_DATA_U16, 4, 0, 2, PID_SCALE(1, 32768), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_COMPONENTS(o2_lambda_voltage_components)},
+    {0x2F, "Fuel tank level", "FUEL_LEVEL", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, PID_SCALE(100, 255), PID_OFFSET(0), PID_PRIORITY_LOW, 5000, PID_NO_COMPONENTS},
+    {0x31, "Distance since codes cleared", "CLR_DIST", PID_UNIT_KM, PID_DATA_U16, 2, 0, 65535, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_LOW, 5000, PID_NO_COMPONENTS},
+    {0x33, "Barometric pressure", "BARO", PID_UNIT_KPA, PID_DATA_U8, 1, 0, 255, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_LOW, 10000, PID_NO_COMPONENTS},
+    {0x40, "PIDs supported [41-60]", "PIDS_C", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_HIGH, 0, PID_NO_COMPONENTS},
+    {0x42, "Control module voltage", "CTRL_VOLT", PID_UNIT_VOLTS, PID_DATA_U16, 2, 0, 65.535f, PID_SCALE(1, 1000), PID_OFFSET(0), PID_PRIORITY_LOW, 5000, PID_NO_COMPONENTS},
+    {0x43, "Absolute load value", "ABS_LOAD", PID_UNIT_PERCENT, PID_DATA_U16, 2, 0, 25700, PID_SCALE(100, 255), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 500, PID_NO_COMPONENTS},
+    {0x44, "Commanded AFR", "CMD_AFR", PID_UNIT_RATIO, PID_DATA_U16, 2, 0, 2, PID_SCALE(1, 32768), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 500, PID_NO_COMPONENTS},
+    {0x45, "Relative throttle position", "REL_TPS", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, PID_SCALE(100, 255), PID_OFFSET(0), PID_PRIORITY_HIGH, 100, PID_NO_COMPONENTS},
+    {0x46, "Ambient air temperature", "AMB_TEMP", PID_UNIT_DEGREES_C, PID_DATA_U8, 1, -40, 215, PID_SCALE(1, 1), PID_OFFSET(-40), PID_PRIORITY_LOW, 10000, PID_NO_COMPONENTS},
+    {0x47, "Absolute throttle position B", "ABS_TPS_B", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, PID_SCALE(100, 255), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 250, PID_NO_COMPONENTS},
+    {0x49, "Accelerator pedal position D", "ACCEL_D", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, PID_SCALE(100, 255), PID_OFFSET(0), PID_PRIORITY_HIGH, 100, PID_NO_COMPONENTS},
+    {0x4A, "Accelerator pedal position E", "ACCEL_E", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, PID_SCALE(100, 255), PID_OFFSET(0), PID_PRIORITY_HIGH, 100, PID_NO_COMPONENTS},
+    {0x4C, "Commanded throttle actuator", "CMD_THROT", PID_UNIT_PERCENT, PID_DATA_U8, 1, 0, 100, PID_SCALE(100, 255), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 250, PID_NO_COMPONENTS},
+    {0x4D, "Time run with MIL on", "MIL_TIME", PID_UNIT_MINUTES, PID_DATA_U16, 2, 0, 65535, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_LOW, 5000, PID_NO_COMPONENTS},
+    {0x4E, "Time since codes cleared", "CLR_TIME", PID_UNIT_MINUTES, PID_DATA_U16, 2, 0, 65535, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_LOW, 5000, PID_NO_COMPONENTS},
+    {0x51, "Fuel type", "FUEL_TYPE", PID_UNIT_NONE, PID_DATA_U8, 1, 0, 255, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_LOW, 0, PID_NO_COMPONENTS},
+    {0x5C, "Engine oil temperature", "OIL_TEMP", PID_UNIT_DEGREES_C, PID_DATA_U8, 1, -40, 210, PID_SCALE(1, 1), PID_OFFSET(-40), PID_PRIORITY_MEDIUM, 2000, PID_NO_COMPONENTS},
+    {0x5E, "Engine fuel rate", "FUEL_RATE", PID_UNIT_LPH, PID_DATA_U16, 2, 0, 3276.75f, PID_SCALE(1, 20), PID_OFFSET(0), PID_PRIORITY_MEDIUM, 1000, PID_NO_COMPONENTS},
+    {0x60, "PIDs supported [61-80]", "PIDS_D", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_HIGH, 0, PID_NO_COMPONENTS},
+    {0x62, "Actual engine torque %", "ACT_TORQ", PID_UNIT_PERCENT, PID_DATA_U8, 1, -125, 130, PID_SCALE(1, 1), PID_OFFSET(-125), PID_PRIORITY_MEDIUM, 500, PID_NO_COMPONENTS},
+    {0x63, "Engine reference torque", "REF_TORQ", PID_UNIT_NM, PID_DATA_U16, 2, 0, 65535, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_LOW, 0, PID_NO_COMPONENTS},
+    {0x80, "PIDs supported [81-A0]", "PIDS_E", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_HIGH, 0, PID_NO_COMPONENTS},
+    {0xA0, "PIDs supported [A1-C0]", "PIDS_F", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_HIGH, 0, PID_NO_COMPONENTS},
+    {0xC0, "PIDs supported [C1-E0]", "PIDS_G", PID_UNIT_NONE, PID_DATA_BITFIELD, 4, 0, 0, PID_SCALE(1, 1), PID_OFFSET(0), PID_PRIORITY_HIGH, 0, PID_NO_COMPONENTS},
+    {0xFF, NULL, NULL, PID_UNIT_NONE, PID_DATA_U8, 0, 0, 0, PID_SCALE(0, 1), PID_OFFSET(0), PID_PRIORITY_MAX, 0, PID_NO_COMPONENTS}
 };
 
 #define PID_DEFINITIONS_COUNT (sizeof(pid_definitions) / sizeof(pid_definitions[0]) - 1)
 
+static bool compute_fuel_economy(const float* inputs, float* output)
+{
+    float fuel_lph = (inputs[0] / 14.7f) * 3600.0f / 745.0f;
+    
+    if (fuel_lph < 0.01f) {
+        return false;
+    }
+    
+    *output = inputs[1] / fuel_lph;
+    return true;
+}
+
+static bool compute_boost(const float* inputs, float* output)
+{
+    *output = inputs[0] - inputs[1];
+    return true;
+}
+
+static bool compute_engine_power(const float* inputs, float* output)
+{
+    float torque_nm = (inputs[0] / 100.0f) * inputs[1];
+    
+    *output = (torque_nm * inputs[2]) / 9549.3f;
+    return true;
+}
+
+static const PidVirtualDefinition_t virtual_definitions[PID_VIRTUAL_COUNT] = {
+    [PID_VIRTUAL_FUEL_ECONOMY] = {PID_VIRTUAL_FUEL_ECONOMY, "Instantaneous fuel economy", "FUEL_ECON", PID_UNIT_KM_PER_L, {0x10, 0x0D, 0x00, 0x00}, 2, 1000, compute_fuel_economy},
+    [PID_VIRTUAL_BOOST] = {PID_VIRTUAL_BOOST, "Boost pressure", "BOOST", PID_UNIT_KPA, {0x0B, 0x33, 0x00, 0x00}, 2, 15000, compute_boost},
+    [PID_VIRTUAL_ENGINE_POWER] = {PID_VIRTUAL_ENGINE_POWER, "Estimated engine power", "POWER", PID_UNIT_KW, {0x62, 0x63, 0x0C, 0x00}, 3, 1000, compute_engine_power}
+};
+
+#define VIRTUAL_DEFINITIONS_COUNT (sizeof(virtual_definitions) / sizeof(virtual_definitions[0]))
+
+static bool virtual_uses_input(const PidVirtualDefinition_t* vdef, u8 pid)
+{
+    for (u8 i = 0U; i < vdef->input_count; i++) {
+        if (vdef->inputs[i] == pid) {
+            return true;
+        }
+    }
+    return false;
+}
+
 static const PidDefinition_t* find_pid_definition(u8 pid)
 {
     for (u32 i = 0U; i < PID_DEFINITIONS_COUNT; i++) {
@@ -83,6 +169,130 @@ static const PidDefinition_t* find_pid_definition(u8 pid)
     return NULL_PTR;
 }
 
+static void init_entry(PidEntry_t* entry, u8 pid)
+{
+    entry->pid = pid;
+    entry->sequence = 0U;
+    entry->component_base = 0U;
+    entry->component_count = 0U;
+    entry->supported = false;
+    entry->enabled = false;
+    entry->rate_ms = 1000U;
+    entry->requested = false;
+    entry->requested_rate_ms = 1000U;
+    entry->last_read_us = 0U;
+    entry->request_sent_us = 0U;
+    entry->request_pending = false;
+    entry->request_count = 0U;
+    entry->keepalive = false;
+    entry->value.valid = false;
+    entry->notify_policy.mode = PID_NOTIFY_ALWAYS;
+    entry->notify_policy.deadband = 0.0f;
+    entry->notify_policy.min_interval_ms = 0U;
+    entry->notified_once = false;
+    entry->last_notify_ms = 0U;
+    entry->notify_count = 0U;
+    entry->suppressed_count = 0U;
+}
+
+static u8 data_type_width(PidDataType_t data_type)
+{
+    switch (data_type) {
+        case PID_DATA_U16:
+        case PID_DATA_I16:
+            return 2U;
+            
+        case PID_DATA_U32:
+        case PID_DATA_BITFIELD:
+            return 4U;
+            
+        case PID_DATA_U8:
+        case PID_DATA_I8:
+        case PID_DATA_FLOAT:
+        case PID_DATA_MAX:
+        default:
+            return 1U;
+    }
+}
+
+static bool unpack_definition(const PidPackDefinition_t* packed, u8 pid, PidDefinition_t* def)
+{
+    if ((packed->unit >= (u8)PID_UNIT_MAX) || (packed->data_type >= (u8)PID_DATA_MAX)) {
+        return false;
+    }
+    
+    if (packed->data_bytes < data_type_width((PidDataType_t)packed->data_type)) {
+        return false;
+    }
+    
+    if (packed->scale_den == 0U) {
+        return false;
+    }
+    
+    def->pid = pid;
+    def->name = packed->name;
+    def->short_name = packed->short_name;
+    def->unit = (PidUnit_t)packed->unit;
+    def->data_type = (PidDataType_t)packed->data_type;
+    def->data_bytes = packed->data_bytes;
+    def->min_value = packed->min_value;
+    def->max_value = packed->max_value;
+    def->scale = (float)packed->scale_num / (float)packed->scale_den;
+    def->scale_num = packed->scale_num;
+    def->scale_den = packed->scale_den;
+    def->offset = (float)packed->offset;
+    def->offset_int = packed->offset;
+    def->priority = packed->priority;
+    def->default_rate_ms = packed->default_rate_ms;
+    def->components = NULL_PTR;
+    def->component_count = 0U;
+    
+    return true;
+}
+
+static const PidDefinition_t* resolve_definition(const PidManager_t* pm, u8 pid, PidDefinition_t* scratch)
+{
+    const PidDefinition_t* def = find_pid_definition(pid);
+    
+    if ((def != NULL_PTR) || (pm->definition_pack == NULL_PTR)) {
+        return def;
+    }
+    
+    PidPackDefinition_t packed;
+    
+    if (PidPack_Find(pm->definition_pack, PID_MODE_LIVE_DATA, pid, &packed) != RESULT_OK) {
+        return NULL_PTR;
+    }
+    
+    if (unpack_definition(&packed, pid, scratch) == false) {
+        return NULL_PTR;
+    }
+    
+    return scratch;
+}
+
+static u8 component_slots(const PidDefinition_t* def)
+{
+    if (def == NULL_PTR) {
+        return 0U;
+    }
+    
+    return (def->component_count < PID_MAX_COMPONENTS) ? def->component_count : PID_MAX_COMPONENTS;
+}
+
+static bool reserve_components(PidManager_t* pm, PidEntry_t* entry, u8 count)
+{
+    if (((u16)pm->component_value_count + count) > PID_COMPONENT_TABLE_SIZE) {
+        return false;
+    }
+    
+    entry->component_base = pm->component_value_count;
+    entry->component_count = count;
+    pm->component_value_count += count;
+    
+    return true;
+}
+
 static PidEntry_t* find_or_create_entry(PidManager_t* pm, u8 pid)
 {
     for (u8 i = 0U; i < pm->entry_count; i++) {
@@ -91,14 +301,16 @@ static PidEntry_t* find_or_create_entry(PidManager_t* pm, u8 pid)
         }
     }
     
-    if (pm->entry_count < 64U) {
+    if (pm->entry_count < PID_MAX_ENTRIES) {
         PidEntry_t* entry = &pm->entries[pm->entry_count];
-        entry->pid = pid;
-        entry->supported = false;
-        entry->enabled = false;
-        entry->rate_ms = 1000U;
-        entry->last_read_ms = 0U;
-        entry->value.valid = false;
+        init_entry(entry, pid);
+        
+        if (reserve_components(pm, entry, component_slots(find_pid_definition(pid))) == false) {
+            return NULL_PTR;
+        }
+        
+        entry->keepalive = (pid == PID_ENGINE_RPM) || (pid == PID_VEHICLE_SPEED);
+        atomic_thread_fence(memory_order_release);
         pm->entry_count++;
         return entry;
     }
@@ -106,9 +318,43 @@ static PidEntry_t* find_or_create_entry(PidManager_t* pm, u8 pid)
     return NULL_PTR;
 }
 
+static u8 enhanced_hash(u8 mode, u16 did, u16 ecu_header)
+{
+    u32 key = ((u32)ecu_header << 16U) | (u32)did;
+    key ^= (u32)mode << 8U;
+    key *= 0x9E3779B1U;
+    return (u8)((key >> 16U) & (PID_ENHANCED_HASH_SIZE - 1U));
+}
+
+static u8 find_enhanced_slot(const PidManager_t* pm, u8 mode, u16 did, u16 ecu_header)
+{
+    u8 bucket = enhanced_hash(mode, did, ecu_header);
+    
+    for (u8 probe = 0U; probe < PID_ENHANCED_HASH_SIZE; probe++) {
+        u8 index = pm->enhanced_index[bucket];
+        
+        if (index == 0U) {
+            break;
+        }
+        
+        const PidEnhancedDefinition_t* def = pm->enhanced_defs[index - 1U];
+        
+        if ((def->mode == mode) && (def->did == did) && (def->ecu_header == ecu_header)) {
+            return (u8)(index - 1U);
+        }
+        
+        bucket = (u8)((bucket + 1U) & (PID_ENHANCED_HASH_SIZE - 1U));
+    }
+    
+    return PID_MAX_ENHANCED;
+}
+
 static const PidEntry_t* find_entry(const PidManager_t* pm, u8 pid)
 {
-    for (u8 i = 0U; i < pm->entry_count; i++) {
+    u8 count = pm->entry_count;
+    atomic_thread_fence(memory_order_acquire);
+    
+    for (u8 i = 0U; i < count; i++) {
         if (pm->entries[i].pid == pid) {
             return &pm->entries[i];
         }
@@ -116,37 +362,2228 @@ static const PidEntry_t* find_entry(const PidManager_t* pm, u8 pid)
     return NULL_PTR;
 }
 
-Result_t PidManager_Init(PidManager_t* pm, const PidManagerConfig_t* config)
+static void store_value(PidManager_t* pm,
+                        PidEntry_t* entry,
+                        const PidValue_t* value,
+                        const PidComponentValue_t* components,
+                        u8 component_count)
 {
-    if (pm == NULL_PTR) {
-        return RESULT_INVALID_PARAM;
+    pm->epoch++;
+    entry->sequence++;
+    atomic_thread_fence(memory_order_release);
+    
+    entry->value = *value;
+    
+    if (component_count > entry->component_count) {
+        component_count = entry->component_count;
     }
     
-    if (config == NULL_PTR) {
-        return RESULT_INVALID_PARAM;
+    for (u8 i = 0U; i < component_count; i++) {
+        pm->component_values[entry->component_base + i] = components[i];
+    }
+    
+    atomic_thread_fence(memory_order_release);
+    entry->sequence++;
+    pm->epoch++;
+}
+
+static bool load_value(const PidEntry_t* entry, PidValue_t* value)
+{
+    for (u8 attempt = 0U; attempt < PID_SEQLOCK_MAX_RETRIES; attempt++) {
+        u32 begin = entry->sequence;
+        atomic_thread_fence(memory_order_acquire);
+        
+        if ((begin & 0x01U) != 0U) {
+            continue;
+        }
+        
+        *value = entry->value;
+        
+        atomic_thread_fence(memory_order_acquire);
+        
+        if (entry->sequence == begin) {
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+static u16 fastest_rate(u16 current, u16 candidate)
+{
+    if (current == 0U) {
+        return candidate;
+    }
+    
+    if ((candidate != 0U) && (candidate < current)) {
+        return candidate;
+    }
+    
+    return current;
+}
+
+static void update_entry_schedule(PidManager_t* pm, PidEntry_t* entry)
+{
+    bool enabled = entry->requested;
+    u16 rate = (entry->requested == true) ? entry->requested_rate_ms : 0U;
+    
+    for (u8 i = 0U; i < PID_MAX_SUBSCRIBERS; i++) {
+        const PidSubscription_t* sub = &pm->subscriptions[i];
+        
+        if (sub->active == false) {
+            continue;
+        }
+        
+        if (PidManager_MaskTest(sub->pid_mask, entry->pid) == true) {
+            enabled = true;
+            rate = fastest_rate(rate, sub->rate_ms);
+        }
+    }
+    
+    for (u32 v = 0U; v < VIRTUAL_DEFINITIONS_COUNT; v++) {
+        const PidEntry_t* ventry = &pm->virtual_entries[v];
+        
+        if ((ventry->enabled == true) && (virtual_uses_input(&virtual_definitions[v], entry->pid) == true)) {
+            enabled = true;
+            rate = fastest_rate(rate, ventry->rate_ms);
+        }
+    }
+    
+    u16 new_rate = (enabled == true) ? rate : entry->requested_rate_ms;
+    
+    if ((entry->enabled != enabled) || (entry->rate_ms != new_rate)) {
+        pm->schedule_generation++;
+    }
+    
+    entry->enabled = enabled;
+    entry->rate_ms = new_rate;
+}
+
+static void rebuild_schedule(PidManager_t* pm)
+{
+    for (u8 i = 0U; i < pm->entry_count; i++) {
+        update_entry_schedule(pm, &pm->entries[i]);
+    }
+}
+
+static float abs_float(float value)
+{
+    return (value < 0.0f) ? -value : value;
+}
+
+static bool should_notify(const PidEntry_t* entry, const PidValue_t* value)
+{
+    const PidNotifyPolicy_t* policy = &entry->notify_policy;
+    
+    if (entry->notified_once == false) {
+        return true;
+    }
+    
+    if (policy->min_interval_ms > 0U) {
+        u32 elapsed = value->timestamp_ms - entry->last_notify_ms;
+        
+        if (elapsed < policy->min_interval_ms) {
+            return false;
+        }
+    }
+    
+    if (policy->mode == PID_NOTIFY_ALWAYS) {
+        return true;
+    }
+    
+    if (value->raw_value == entry->last_notified_raw) {
+        return false;
+    }
+    
+    float delta = abs_float(value->eng_value - entry->last_notified_eng);
+    
+    switch (policy->mode) {
+        case PID_NOTIFY_DEADBAND_ABS:
+            return (delta >= policy->deadband);
+            
+        case PID_NOTIFY_DEADBAND_REL:
+            return (delta >= (policy->deadband * abs_float(entry->last_notified_eng)));
+            
+        case PID_NOTIFY_ON_CHANGE:
+        case PID_NOTIFY_ALWAYS:
+        case PID_NOTIFY_MAX:
+        default:
+            return true;
+    }
+}
+
+static bool record_notification(PidManager_t* pm, PidEntry_t* entry, const PidValue_t* value)
+{
+    if (should_notify(entry, value) == false) {
+        entry->suppressed_count++;
+        pm->total_suppressed++;
+        return false;
+    }
+    
+    entry->notified_once = true;
+    entry->last_notified_raw = value->raw_value;
+    entry->last_notified_eng = value->eng_value;
+    entry->last_notify_ms = value->timestamp_ms;
+    entry->notify_count++;
+    pm->total_notified++;
+    
+    return true;
+}
+
+static void publish_value(PidManager_t* pm, PidEntry_t* entry, const PidValue_t* value)
+{
+    if (record_notification(pm, entry, value) == false) {
+        return;
+    }
+    
+    if (pm->value_callback != NULL_PTR) {
+        pm->value_callback(entry->pid, value, pm->callback_context);
+    }
+    
+    for (u8 i = 0U; i < PID_MAX_SUBSCRIBERS; i++) {
+        const PidSubscription_t* sub = &pm->subscriptions[i];
+        
+        if ((sub->active == true) && (PidManager_MaskTest(sub->pid_mask, entry->pid) == true)) {
+            sub->callback(entry->pid, value, sub->context);
+        }
+    }
+}
+
+static i32 decode_raw(const PidDefinition_t* def, const u8* raw_data)
+{
+    i32 raw = 0;
+    
+    switch (def->data_type) {
+        case PID_DATA_U8:
+            raw = (i32)raw_data[0];
+            break;
+            
+        case PID_DATA_U16:
+            raw = (i32)(((u16)raw_data[0] << 8U) | (u16)raw_data[1]);
+            break;
+            
+        case PID_DATA_U32:
+            raw = (i32)(((u32)raw_data[0] << 24U) | 
+                        ((u32)raw_data[1] << 16U) |
+                        ((u32)raw_data[2] << 8U) | 
+                        (u32)raw_data[3]);
+            break;
+            
+        case PID_DATA_I8:
+            raw = (i32)(i8)raw_data[0];
+            break;
+            
+        case PID_DATA_I16:
+            raw = (i32)(i16)(((u16)raw_data[0] << 8U) | (u16)raw_data[1]);
+            break;
+            
+        case PID_DATA_BITFIELD:
+            raw = (i32)(((u32)raw_data[0] << 24U) | 
+                        ((u32)raw_data[1] << 16U) |
+                        ((u32)raw_data[2] << 8U) | 
+                        (u32)raw_data[3]);
+            break;
+            
+        case PID_DATA_FLOAT:
+        case PID_DATA_MAX:
+        default:
+            raw = (i32)raw_data[0];
+            break;
+    }
+    
+    return raw;
+}
+
+static i32 scale_fixed(const PidDefinition_t* def, i32 raw)
+{
+    i64 result = ((i64)raw * (i64)def->scale_num) + ((i64)def->offset_int * (i64)def->scale_den);
+    
+    if (result > (i64)0x7FFFFFFF) {
+        return (i32)0x7FFFFFFF;
+    }
+    
+    if (result < -(i64)0x7FFFFFFF) {
+        return -(i32)0x7FFFFFFF;
+    }
+    
+    return (i32)result;
+}
+
+static u8 decode_components(const PidDefinition_t* def,
+                            const u8* raw_data,
+                            u8 data_len,
+                            PidComponentValue_t* components,
+                            u8 max_components)
+{
+    u8 count = 0U;
+    
+    for (u8 i = 0U; (i < def->component_count) && (count < max_components); i++) {
+        const PidComponent_t* comp = &def->components[i];
+        
+        if ((comp->byte_offset + comp->byte_count) > data_len) {
+            break;
+        }
+        
+        u32 field = 0U;
+        
+        for (u8 b = 0U; b < comp->byte_count; b++) {
+            field = (field << 8U) | (u32)raw_data[comp->byte_offset + b];
+        }
+        
+        field >>= comp->bit_offset;
+        
+        if (comp->bit_count < 32U) {
+            field &= (1UL << comp->bit_count) - 1UL;
+        }
+        
+        components[count].raw_value = field;
+        components[count].eng_value = ((float)field * comp->scale) + comp->offset;
+        count++;
+    }
+    
+    return count;
+}
+
+static void decode_column_u8(const u8* raw_bytes, u8 stride, u32 count, i32* raw_values)
+{
+    for (u32 i = 0U; i < count; i++) {
+        raw_values[i] = (i32)raw_bytes[i * stride];
+    }
+}
+
+static void decode_column(PidDataType_t data_type, const u8* raw_bytes, u8 stride, u32 count, i32* raw_values)
+{
+    switch (data_type) {
+        case PID_DATA_U16:
+            for (u32 i = 0U; i < count; i++) {
+                const u8* b = &raw_bytes[i * stride];
+                raw_values[i] = (i32)(((u16)b[0] << 8U) | (u16)b[1]);
+            }
+            break;
+            
+        case PID_DATA_U32:
+        case PID_DATA_BITFIELD:
+            for (u32 i = 0U; i < count; i++) {
+                const u8* b = &raw_bytes[i * stride];
+                raw_values[i] = (i32)(((u32)b[0] << 24U) |
+                                      ((u32)b[1] << 16U) |
+                                      ((u32)b[2] << 8U) |
+                                      (u32)b[3]);
+            }
+            break;
+            
+        case PID_DATA_I8:
+            for (u32 i = 0U; i < count; i++) {
+                raw_values[i] = (i32)(i8)raw_bytes[i * stride];
+            }
+            break;
+            
+        case PID_DATA_I16:
+            for (u32 i = 0U; i < count; i++) {
+                const u8* b = &raw_bytes[i * stride];
+                raw_values[i] = (i32)(i16)(((u16)b[0] << 8U) | (u16)b[1]);
+            }
+            break;
+            
+        case PID_DATA_U8:
+        case PID_DATA_FLOAT:
+        case PID_DATA_MAX:
+        default:
+            decode_column_u8(raw_bytes, stride, count, raw_values);
+            break;
+    }
+}
+
+static void scale_column(const i32* restrict raw_values, u32 count, float scale, float offset, float* restrict eng_values)
+{
+    for (u32 i = 0U; i < count; i++) {
+        eng_values[i] = ((float)raw_values[i] * scale) + offset;
+    }
+}
+
+static Result_t convert_with_definition(const PidDefinition_t* def, const u8* raw_data, u8 data_len, PidValue_t* value)
+{
+    if (data_len < def->data_bytes) {
+        return RESULT_ERROR;
+    }
+    
+    i32 raw = decode_raw(def, raw_data);
+    
+    value->raw_value = raw;
+    value->eng_value = ((float)raw * def->scale) + def->offset;
+    value->unit = def->unit;
+    value->valid = true;
+    
+    return RESULT_OK;
+}
+
+static u16 effective_rate(const PidManager_t* pm, const PidEntry_t* entry)
+{
+    if (entry->enabled == false) {
+        return 0U;
+    }
+    
+    if (pm->poll_profile == PID_POLL_KEEPALIVE) {
+        return (entry->keepalive == true) ? pm->keepalive_rate_ms : 0U;
+    }
+    
+    return entry->rate_ms;
+}
+
+static bool entry_is_due(const PidManager_t* pm, const PidEntry_t* entry, u64 current_time, u32* overdue)
+{
+    u16 rate_ms = effective_rate(pm, entry);
+    
+    if (rate_ms == 0U) {
+        return false;
+    }
+    
+    u64 due_time = entry->last_read_us + CLOCK_MS_TO_US(rate_ms);
+    
+    if (current_time < due_time) {
+        return false;
+    }
+    
+    *overdue = (u32)((current_time - due_time) / CLOCK_US_PER_MS);
+    return true;
+}
+
+static PidEntry_t* find_request_entry(PidManager_t* pm, const PidRequest_t* request)
+{
+    if (request->mode == PID_MODE_LIVE_DATA) {
+        if (request->did > 0xFFU) {
+            return NULL_PTR;
+        }
+        
+        for (u8 i = 0U; i < pm->entry_count; i++) {
+            if (pm->entries[i].pid == (u8)request->did) {
+                return &pm->entries[i];
+            }
+        }
+        
+        return NULL_PTR;
+    }
+    
+    u8 slot = find_enhanced_slot(pm, request->mode, request->did, request->ecu_header);
+    
+    if (slot == PID_MAX_ENHANCED) {
+        return NULL_PTR;
+    }
+    
+    return &pm->enhanced_entries[slot];
+}
+
+static u8 entry_priority(const PidManager_t* pm, const PidEntry_t* entry, const PidEnhancedDefinition_t* enhanced)
+{
+    u8 priority = PID_PRIORITY_LOW;
+    
+    if (enhanced != NULL_PTR) {
+        priority = enhanced->def.priority;
+    } else {
+        PidDefinition_t pack_def;
+        const PidDefinition_t* def = resolve_definition(pm, entry->pid, &pack_def);
+        
+        if (def != NULL_PTR) {
+            priority = def->priority;
+        }
+    }
+    
+    return (priority < PID_PRIORITY_MAX) ? priority : PID_PRIORITY_LOW;
+}
+
+static u32 class_start_time(const PidManager_t* pm, u8 priority)
+{
+    u32 virtual_time = pm->classes[priority].virtual_time;
+    
+    if ((i32)(virtual_time - pm->system_virtual_time) < 0) {
+        return pm->system_virtual_time;
+    }
+    
+    return virtual_time;
+}
+
+static const PidEntry_t* select_next_entry(const PidManager_t* pm,
+                                           bool include_enhanced,
+                                           const PidEnhancedDefinition_t** enhanced)
+{
+    const PidEntry_t* class_best[PID_PRIORITY_MAX];
+    const PidEnhancedDefinition_t* class_enhanced[PID_PRIORITY_MAX];
+    u32 class_overdue[PID_PRIORITY_MAX];
+    
+    for (u8 c = 0U; c < PID_PRIORITY_MAX; c++) {
+        class_best[c] = NULL_PTR;
+        class_enhanced[c] = NULL_PTR;
+        class_overdue[c] = 0U;
+    }
+    
+    u64 current_time = Clock_NowUs(pm->clock);
+    
+    u8 total = pm->entry_count + ((include_enhanced == true) ? pm->enhanced_count : 0U);
+    
+    for (u8 i = 0U; i < total; i++) {
+        const PidEntry_t* entry;
+        const PidEnhancedDefinition_t* def = NULL_PTR;
+        u32 overdue = 0U;
+        
+        if (i < pm->entry_count) {
+            entry = &pm->entries[i];
+        } else {
+            entry = &pm->enhanced_entries[i - pm->entry_count];
+            def = pm->enhanced_defs[i - pm->entry_count];
+        }
+        
+        if (entry_is_due(pm, entry, current_time, &overdue) == false) {
+            continue;
+        }
+        
+        u8 priority = entry_priority(pm, entry, def);
+        
+        if ((class_best[priority] == NULL_PTR) || (overdue > class_overdue[priority])) {
+            class_best[priority] = entry;
+            class_enhanced[priority] = def;
+            class_overdue[priority] = overdue;
+        }
+    }
+    
+    u8 chosen = PID_PRIORITY_MAX;
+    u32 chosen_start = 0U;
+    
+    for (u8 c = 0U; c < PID_PRIORITY_MAX; c++) {
+        if (class_best[c] == NULL_PTR) {
+            continue;
+        }
+        
+        if (pm->schedule_policy == PID_POLICY_STRICT) {
+            chosen = c;
+            break;
+        }
+        
+        u32 start = class_start_time(pm, c);
+        
+        if ((chosen == PID_PRIORITY_MAX) || ((i32)(start - chosen_start) < 0)) {
+            chosen = c;
+            chosen_start = start;
+        }
+    }
+    
+    if (chosen == PID_PRIORITY_MAX) {
+        return NULL_PTR;
+    }
+    
+    *enhanced = class_enhanced[chosen];
+    return class_best[chosen];
+}
+
+static void charge_request(PidManager_t* pm, const PidEntry_t* entry, const PidEnhancedDefinition_t* enhanced)
+{
+    u8 priority = entry_priority(pm, entry, enhanced);
+    PidClassState_t* cls = &pm->classes[priority];
+    u32 start = class_start_time(pm, priority);
+    
+    pm->system_virtual_time = start;
+    cls->virtual_time = start + (PID_FAIR_COST_SCALE / cls->weight);
+    cls->requests++;
+}
+
+static u32 apply_frame_timing(PidManager_t* pm,
+                              PidEntry_t* entry,
+                              const PidEnhancedDefinition_t* enhanced,
+                              const PidFrameTiming_t* timing,
+                              PidValue_t* value)
+{
+    u32 latency_ms = PID_STATS_NO_LATENCY;
+    
+    if ((timing != NULL_PTR) && (timing->rx_time_us != 0U)) {
+        value->rx_time_us = timing->rx_time_us;
+    } else {
+        value->rx_time_us = Clock_NowUs(pm->clock);
+    }
+    
+    if ((timing != NULL_PTR) && (timing->request_time_us != 0U)) {
+        value->request_time_us = timing->request_time_us;
+    } else {
+        value->request_time_us = (entry->request_pending == true) ? entry->request_sent_us : 0U;
+    }
+    
+    value->timestamp_ms = CLOCK_US_TO_MS(value->rx_time_us);
+    
+    if ((value->request_time_us != 0U) && (value->rx_time_us >= value->request_time_us)) {
+        latency_ms = CLOCK_US_TO_MS(value->rx_time_us - value->request_time_us);
+    }
+    
+    if (entry->request_pending == false) {
+        charge_request(pm, entry, enhanced);
+    }
+    
+    entry->last_read_us = value->rx_time_us;
+    entry->request_pending = false;
+    
+    return latency_ms;
+}
+
+static bool virtual_inputs_fresh(const PidManager_t* pm,
+                                 const PidVirtualDefinition_t* vdef,
+                                 u32 timestamp_ms,
+                                 float* inputs)
+{
+    for (u8 i = 0U; i < vdef->input_count; i++) {
+        const PidEntry_t* input = find_entry(pm, vdef->inputs[i]);
+        
+        if ((input == NULL_PTR) || (input->value.valid == false) ||
+            ((timestamp_ms - input->value.timestamp_ms) > vdef->max_input_age_ms)) {
+            return false;
+        }
+        
+        if (inputs != NULL_PTR) {
+            inputs[i] = input->value.eng_value;
+        }
+    }
+    
+    return true;
+}
+
+static void update_virtuals(PidManager_t* pm, u8 input_pid, const PidValue_t* trigger)
+{
+    u32 timestamp_ms = trigger->timestamp_ms;
+    
+    for (u32 v = 0U; v < VIRTUAL_DEFINITIONS_COUNT; v++) {
+        const PidVirtualDefinition_t* vdef = &virtual_definitions[v];
+        
+        PidEntry_t* ventry = &pm->virtual_entries[v];
+        
+        if ((ventry->enabled == false) || (virtual_uses_input(vdef, input_pid) == false)) {
+            continue;
+        }
+        
+        float inputs[PID_VIRTUAL_MAX_INPUTS];
+        bool fresh = virtual_inputs_fresh(pm, vdef, timestamp_ms, inputs);
+        
+        PidValue_t value;
+        value.raw_value = 0;
+        value.eng_value = 0.0f;
+        value.unit = vdef->unit;
+        value.timestamp_ms = timestamp_ms;
+        value.rx_time_us = trigger->rx_time_us;
+        value.request_time_us = trigger->request_time_us;
+        value.valid = false;
+        
+        if (fresh == true) {
+            value.valid = vdef->compute(inputs, &value.eng_value);
+        }
+        
+        store_value(pm, ventry, &value, NULL_PTR, 0U);
+        ventry->last_read_us = trigger->rx_time_us;
+        
+        if ((value.valid == true) && (record_notification(pm, ventry, &value) == true) &&
+            (pm->virtual_callback != NULL_PTR)) {
+            pm->virtual_callback(vdef, &value, pm->callback_context);
+        }
+    }
+}
+
+static u8 count_trailing_zeros(u32 value)
+{
+    static const u8 debruijn_positions[32] = {
+        0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+        31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+    };
+    
+    return debruijn_positions[((value & (0U - value)) * 0x077CB531U) >> 27U];
+}
+
+static u32 reverse_bits(u32 value)
+{
+    value = ((value >> 1U) & 0x55555555U) | ((value & 0x55555555U) << 1U);
+    value = ((value >> 2U) & 0x33333333U) | ((value & 0x33333333U) << 2U);
+    value = ((value >> 4U) & 0x0F0F0F0FU) | ((value & 0x0F0F0F0FU) << 4U);
+    value = ((value >> 8U) & 0x00FF00FFU) | ((value & 0x00FF00FFU) << 8U);
+    return (value >> 16U) | (value << 16U);
+}
+
+static void apply_supported_word(PidManager_t* pm, u8 word_idx, u32 word)
+{
+    u32 added = word & ~pm->supported_map[word_idx];
+    
+    pm->supported_map[word_idx] = word;
+    
+    while (added != 0U) {
+        u8 pid = (u8)((word_idx * 32U) + count_trailing_zeros(added));
+        added &= added - 1U;
+        
+        PidEntry_t* entry = find_or_create_entry(pm, pid);
+        if (entry != NULL_PTR) {
+            entry->supported = true;
+            
+            PidDefinition_t pack_def;
+            const PidDefinition_t* def = resolve_definition(pm, pid, &pack_def);
+            if (def != NULL_PTR) {
+                entry->requested_rate_ms = def->default_rate_ms;
+                update_entry_schedule(pm, entry);
+            }
+        }
+    }
+}
+
+static void apply_supported_range(PidManager_t* pm, u8 start_pid, const u8* data)
+{
+    u32 bitmap = ((u32)data[0] << 24U) |
+                 ((u32)data[1] << 16U) |
+                 ((u32)data[2] << 8U) |
+                 (u32)data[3];
+    u32 reversed = reverse_bits(bitmap);
+    u8 word_idx = start_pid / 32U;
+    
+    apply_supported_word(pm, word_idx, (pm->supported_map[word_idx] & 0x01U) | (reversed << 1U));
+    
+    if ((word_idx + 1U) < PID_SUPPORTED_WORDS) {
+        u32 next = pm->supported_map[word_idx + 1U];
+        apply_supported_word(pm, (u8)(word_idx + 1U), (next & ~0x01U) | (reversed >> 31U));
+    }
+}
+
+static PidSupportCacheEntry_t* find_cache_entry(PidSupportCache_t* cache, const char* vin)
+{
+    for (u8 i = 0U; i < PID_SUPPORT_CACHE_SIZE; i++) {
+        if ((cache->entries[i].valid == true) &&
+            (strncmp(cache->entries[i].vin, vin, PID_CACHE_VIN_LENGTH) == 0)) {
+            return &cache->entries[i];
+        }
+    }
+    return NULL_PTR;
+}
+
+Result_t PidManager_Init(PidManager_t* pm, const PidManagerConfig_t* config)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (config == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    for (u8 w = 0U; w < PID_SUPPORTED_WORDS; w++) {
+        pm->supported_map[w] = 0U;
+    }
+    
+    pm->discovery.next_range = 0x00U;
+    pm->discovery.batch_count = 0U;
+    pm->discovery.received_mask = 0U;
+    pm->discovery.continuation_mask = 0U;
+    pm->discovery.active = false;
+    pm->discovery.complete = false;
+    
+    pm->entry_count = 0U;
+    pm->epoch = 0U;
+    pm->enhanced_count = 0U;
+    pm->pack_enhanced_count = 0U;
+    pm->definition_pack = NULL_PTR;
+    PidStats_Init(&pm->stats);
+    pm->poll_profile = PID_POLL_FULL;
+    pm->keepalive_rate_ms = PID_KEEPALIVE_RATE_MS;
+    pm->schedule_policy = PID_POLICY_STRICT;
+    pm->system_virtual_time = 0U;
+    pm->schedule_generation = 0U;
+    pm->class_window_start_us = 0U;
+    
+    for (u8 c = 0U; c < PID_PRIORITY_MAX; c++) {
+        pm->classes[c].virtual_time = 0U;
+        pm->classes[c].requests = 0U;
+    }
+    
+    pm->classes[PID_PRIORITY_HIGH].weight = PID_FAIR_WEIGHT_HIGH;
+    pm->classes[PID_PRIORITY_MEDIUM].weight = PID_FAIR_WEIGHT_MEDIUM;
+    pm->classes[PID_PRIORITY_LOW].weight = PID_FAIR_WEIGHT_LOW;
+    
+    for (u8 i = 0U; i < PID_ENHANCED_HASH_SIZE; i++) {
+        pm->enhanced_index[i] = 0U;
+    }
+    
+    for (u8 v = 0U; v < PID_VIRTUAL_COUNT; v++) {
+        init_entry(&pm->virtual_entries[v], PID_ENTRY_NO_PID);
+        pm->virtual_entries[v].rate_ms = 0U;
+        pm->virtual_entries[v].requested_rate_ms = 0U;
+    }
+    
+    pm->component_value_count = 0U;
+    pm->total_notified = 0U;
+    pm->total_suppressed = 0U;
+    
+    for (u8 i = 0U; i < PID_MAX_SUBSCRIBERS; i++) {
+        pm->subscriptions[i].active = false;
+        pm->subscriptions[i].callback = NULL_PTR;
+        pm->subscriptions[i].context = NULL_PTR;
+    }
+    
+    pm->error_handler = config->error_handler;
+    pm->value_callback = config->value_callback;
+    pm->enhanced_callback = config->enhanced_callback;
+    pm->virtual_callback = config->virtual_callback;
+    pm->callback_context = config->callback_context;
+    pm->clock = config->clock;
+    pm->initialized = true;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_SetDefinitionPack(PidManager_t* pm, const PidPack_t* pack)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if ((pack != NULL_PTR) && (pack->loaded == false)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    pm->definition_pack = pack;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_SetSupported(PidManager_t* pm, const u8* supported_data, u8 start_pid)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (supported_data == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    apply_supported_range(pm, start_pid, supported_data);
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_ApplySupportedMap(PidManager_t* pm, const u32* supported_map)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (supported_map == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    for (u8 w = 0U; w < PID_SUPPORTED_WORDS; w++) {
+        apply_supported_word(pm, w, supported_map[w]);
+    }
+    
+    return RESULT_OK;
+}
+
+bool PidManager_IsSupported(const PidManager_t* pm, u8 pid)
+{
+    if (pm == NULL_PTR) {
+        return false;
+    }
+    
+    if (pm->initialized == false) {
+        return false;
+    }
+    
+    return ((pm->supported_map[pid / 32U] >> (pid % 32U)) & 0x01U) != 0U;
+}
+
+Result_t PidManager_StartDiscovery(PidManager_t* pm)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    pm->discovery.next_range = 0x00U;
+    pm->discovery.batch_count = 0U;
+    pm->discovery.received_mask = 0U;
+    pm->discovery.continuation_mask = 0U;
+    pm->discovery.active = true;
+    pm->discovery.complete = false;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_GetDiscoveryRequest(PidManager_t* pm, u8* ranges, u8 max_ranges, u8* range_count)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if ((ranges == NULL_PTR) || (range_count == NULL_PTR)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    *range_count = 0U;
+    
+    if ((pm->discovery.active == false) || (pm->discovery.complete == true)) {
+        return RESULT_NO_DATA;
+    }
+    
+    if (max_ranges > PID_DISCOVERY_MAX_BATCH) {
+        max_ranges = PID_DISCOVERY_MAX_BATCH;
+    }
+    
+    u16 range = pm->discovery.next_range;
+    u8 count = 0U;
+    
+    while ((count < max_ranges) && (range < PID_MAX_COUNT)) {
+        pm->discovery.batch[count] = (u8)range;
+        ranges[count] = (u8)range;
+        count++;
+        range += PID_SUPPORTED_RANGE_STEP;
+    }
+    
+    pm->discovery.batch_count = count;
+    pm->discovery.received_mask = 0U;
+    pm->discovery.continuation_mask = 0U;
+    *range_count = count;
+    
+    return (count > 0U) ? RESULT_OK : RESULT_NO_DATA;
+}
+
+Result_t PidManager_ProcessDiscoveryResponse(PidManager_t* pm, u8 range_pid, const u8* data, u8 data_len)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (data == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if ((data_len < PID_SUPPORTED_BYTES) || ((range_pid % PID_SUPPORTED_RANGE_STEP) != 0U)) {
+        return RESULT_ERROR;
+    }
+    
+    for (u8 i = 0U; i < pm->discovery.batch_count; i++) {
+        if (pm->discovery.batch[i] == range_pid) {
+            pm->discovery.received_mask |= (u8)(1U << i);
+            
+            if ((data[3] & 0x01U) != 0U) {
+                pm->discovery.continuation_mask |= (u8)(1U << i);
+            }
+        }
+    }
+    
+    apply_supported_range(pm, range_pid, data);
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_CompleteDiscoveryBatch(PidManager_t* pm)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (pm->discovery.active == false) {
+        return RESULT_ERROR;
+    }
+    
+    u8 linked = 0U;
+    
+    while ((linked < pm->discovery.batch_count) &&
+           ((pm->discovery.received_mask & (1U << linked)) != 0U) &&
+           ((pm->discovery.continuation_mask & (1U << linked)) != 0U)) {
+        linked++;
+    }
+    
+    if ((linked == pm->discovery.batch_count) && (linked > 0U) &&
+        (((u16)pm->discovery.batch[linked - 1U] + PID_SUPPORTED_RANGE_STEP) < PID_MAX_COUNT)) {
+        pm->discovery.next_range = (u8)(pm->discovery.batch[linked - 1U] + PID_SUPPORTED_RANGE_STEP);
+    } else {
+        pm->discovery.complete = true;
+    }
+    
+    pm->discovery.batch_count = 0U;
+    
+    return RESULT_OK;
+}
+
+bool PidManager_IsDiscoveryComplete(const PidManager_t* pm)
+{
+    if (pm == NULL_PTR) {
+        return false;
+    }
+    
+    if (pm->initialized == false) {
+        return false;
+    }
+    
+    return pm->discovery.complete;
+}
+
+Result_t PidSupportCache_Init(PidSupportCache_t* cache)
+{
+    if (cache == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    for (u8 i = 0U; i < PID_SUPPORT_CACHE_SIZE; i++) {
+        cache->entries[i].vin[0] = '\0';
+        cache->entries[i].last_used = 0U;
+        cache->entries[i].valid = false;
+    }
+    
+    cache->use_counter = 0U;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_SaveSupportCache(const PidManager_t* pm, PidSupportCache_t* cache, const char* vin)
+{
+    if ((pm == NULL_PTR) || (cache == NULL_PTR) || (vin == NULL_PTR)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    PidSupportCacheEntry_t* slot = find_cache_entry(cache, vin);
+    
+    if (slot == NULL_PTR) {
+        slot = &cache->entries[0];
+        
+        for (u8 i = 0U; i < PID_SUPPORT_CACHE_SIZE; i++) {
+            if (cache->entries[i].valid == false) {
+                slot = &cache->entries[i];
+                break;
+            }
+            
+            if (cache->entries[i].last_used < slot->last_used) {
+                slot = &cache->entries[i];
+            }
+        }
+        
+        u8 i = 0U;
+        while ((i < PID_CACHE_VIN_LENGTH) && (vin[i] != '\0')) {
+            slot->vin[i] = vin[i];
+            i++;
+        }
+        slot->vin[i] = '\0';
+    }
+    
+    for (u8 w = 0U; w < PID_SUPPORTED_WORDS; w++) {
+        slot->supported_map[w] = pm->supported_map[w];
+    }
+    
+    cache->use_counter++;
+    slot->last_used = cache->use_counter;
+    slot->valid = true;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_LoadSupportCache(PidManager_t* pm, PidSupportCache_t* cache, const char* vin)
+{
+    if ((pm == NULL_PTR) || (cache == NULL_PTR) || (vin == NULL_PTR)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    PidSupportCacheEntry_t* slot = find_cache_entry(cache, vin);
+    
+    if (slot == NULL_PTR) {
+        return RESULT_NO_DATA;
+    }
+    
+    for (u8 w = 0U; w < PID_SUPPORTED_WORDS; w++) {
+        apply_supported_word(pm, w, slot->supported_map[w]);
+    }
+    
+    cache->use_counter++;
+    slot->last_used = cache->use_counter;
+    
+    pm->discovery.active = false;
+    pm->discovery.complete = true;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_EnablePid(PidManager_t* pm, u8 pid, u16 rate_ms)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    PidEntry_t* entry = find_or_create_entry(pm, pid);
+    
+    if (entry == NULL_PTR) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    entry->requested = true;
+    entry->requested_rate_ms = rate_ms;
+    update_entry_schedule(pm, entry);
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_DisablePid(PidManager_t* pm, u8 pid)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    for (u8 i = 0U; i < pm->entry_count; i++) {
+        if (pm->entries[i].pid == pid) {
+            pm->entries[i].requested = false;
+            update_entry_schedule(pm, &pm->entries[i]);
+            return RESULT_OK;
+        }
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_SetRate(PidManager_t* pm, u8 pid, u16 rate_ms)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    for (u8 i = 0U; i < pm->entry_count; i++) {
+        if (pm->entries[i].pid == pid) {
+            pm->entries[i].requested_rate_ms = rate_ms;
+            update_entry_schedule(pm, &pm->entries[i]);
+            return RESULT_OK;
+        }
+    }
+    
+    return RESULT_ERROR;
+}
+
+Result_t PidManager_Subscribe(PidManager_t* pm,
+                             const u8* pid_mask,
+                             u16 rate_ms,
+                             PidValueCallback_t callback,
+                             void* context,
+                             u8* subscription_id)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if ((pid_mask == NULL_PTR) || (callback == NULL_PTR)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    u8 slot = PID_MAX_SUBSCRIBERS;
+    
+    for (u8 i = 0U; i < PID_MAX_SUBSCRIBERS; i++) {
+        if (pm->subscriptions[i].active == false) {
+            slot = i;
+            break;
+        }
+    }
+    
+    if (slot >= PID_MAX_SUBSCRIBERS) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    u16 missing = 0U;
+    u16 slots = 0U;
+    
+    for (u16 pid = 0U; pid < PID_MAX_COUNT; pid++) {
+        if ((PidManager_MaskTest(pid_mask, (u8)pid) == true) && (find_entry(pm, (u8)pid) == NULL_PTR)) {
+            missing++;
+            slots += component_slots(find_pid_definition((u8)pid));
+        }
+    }
+    
+    if ((missing > (u16)(PID_MAX_ENTRIES - pm->entry_count)) ||
+        (slots > (u16)(PID_COMPONENT_TABLE_SIZE - pm->component_value_count))) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    for (u16 pid = 0U; pid < PID_MAX_COUNT; pid++) {
+        if (PidManager_MaskTest(pid_mask, (u8)pid) == true) {
+            (void)find_or_create_entry(pm, (u8)pid);
+        }
+    }
+    
+    PidSubscription_t* sub = &pm->subscriptions[slot];
+    
+    for (u8 i = 0U; i < PID_MASK_BYTES; i++) {
+        sub->pid_mask[i] = pid_mask[i];
+    }
+    
+    sub->rate_ms = rate_ms;
+    sub->callback = callback;
+    sub->context = context;
+    sub->active = true;
+    
+    rebuild_schedule(pm);
+    
+    if (subscription_id != NULL_PTR) {
+        *subscription_id = slot;
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_Unsubscribe(PidManager_t* pm, u8 subscription_id)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if ((subscription_id >= PID_MAX_SUBSCRIBERS) ||
+        (pm->subscriptions[subscription_id].active == false)) {
+        return RESULT_ERROR;
+    }
+    
+    pm->subscriptions[subscription_id].active = false;
+    
+    rebuild_schedule(pm);
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_SetSubscriptionRate(PidManager_t* pm, u8 subscription_id, u16 rate_ms)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if ((subscription_id >= PID_MAX_SUBSCRIBERS) ||
+        (pm->subscriptions[subscription_id].active == false)) {
+        return RESULT_ERROR;
+    }
+    
+    pm->subscriptions[subscription_id].rate_ms = rate_ms;
+    
+    rebuild_schedule(pm);
+    
+    return RESULT_OK;
+}
+
+void PidManager_MaskSet(u8* pid_mask, u8 pid)
+{
+    if (pid_mask != NULL_PTR) {
+        pid_mask[pid / 8U] |= (u8)(1U << (pid % 8U));
+    }
+}
+
+bool PidManager_MaskTest(const u8* pid_mask, u8 pid)
+{
+    if (pid_mask == NULL_PTR) {
+        return false;
+    }
+    
+    return ((pid_mask[pid / 8U] >> (pid % 8U)) & 0x01U) != 0U;
+}
+
+Result_t PidManager_SetNotifyPolicy(PidManager_t* pm, u8 pid, const PidNotifyPolicy_t* policy)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (policy == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if ((policy->mode >= PID_NOTIFY_MAX) || (isfinite(policy->deadband) == 0) || (policy->deadband < 0.0f)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    PidEntry_t* entry = find_or_create_entry(pm, pid);
+    
+    if (entry == NULL_PTR) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    entry->notify_policy = *policy;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_GetNotifyStats(const PidManager_t* pm, u8 pid, u32* notified, u32* suppressed)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    const PidEntry_t* entry = find_entry(pm, pid);
+    
+    if (entry == NULL_PTR) {
+        return RESULT_NO_DATA;
+    }
+    
+    if (notified != NULL_PTR) {
+        *notified = entry->notify_count;
+    }
+    
+    if (suppressed != NULL_PTR) {
+        *suppressed = entry->suppressed_count;
+    }
+    
+    return RESULT_OK;
+}
+
+void PidManager_GetNotifyTotals(const PidManager_t* pm, u32* notified, u32* suppressed)
+{
+    u32 total_notified = 0U;
+    u32 total_suppressed = 0U;
+    
+    if ((pm != NULL_PTR) && (pm->initialized == true)) {
+        total_notified = pm->total_notified;
+        total_suppressed = pm->total_suppressed;
+    }
+    
+    if (notified != NULL_PTR) {
+        *notified = total_notified;
+    }
+    
+    if (suppressed != NULL_PTR) {
+        *suppressed = total_suppressed;
+    }
+}
+
+Result_t PidManager_ProcessFrame(PidManager_t* pm, const Obd2Frame_t* frame)
+{
+    return PidManager_ProcessEcuFrame(pm, frame, PID_STATS_ECU_ANY);
+}
+
+Result_t PidManager_ProcessEcuFrame(PidManager_t* pm, const Obd2Frame_t* frame, u16 ecu_header)
+{
+    return PidManager_ProcessFrameTimed(pm, frame, ecu_header, NULL_PTR);
+}
+
+Result_t PidManager_ProcessFrameTimed(PidManager_t* pm,
+                                      const Obd2Frame_t* frame,
+                                      u16 ecu_header,
+                                      const PidFrameTiming_t* timing)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (frame == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (frame->valid == false) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (frame->mode != OBD2_MODE_01_LIVE_DATA) {
+        return RESULT_OK;
+    }
+    
+    PidEntry_t* entry = find_or_create_entry(pm, frame->pid);
+    
+    if (entry == NULL_PTR) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    PidDefinition_t pack_def;
+    const PidDefinition_t* def = resolve_definition(pm, frame->pid, &pack_def);
+    PidValue_t value;
+    value.timestamp_ms = 0U;
+    value.rx_time_us = 0U;
+    value.request_time_us = 0U;
+    value.valid = false;
+    Result_t result;
+    
+    if (def != NULL_PTR) {
+        result = convert_with_definition(def, frame->data, frame->data_length, &value);
+    } else {
+        result = PidManager_ConvertRawToEng(frame->pid, frame->data, frame->data_length, &value);
+    }
+    
+    if (result != RESULT_OK) {
+        PidStats_RecordDecodeFailure(&pm->stats, PID_MODE_LIVE_DATA, frame->pid, ecu_header);
+    }
+    
+    if (result == RESULT_OK) {
+        u32 latency_ms = apply_frame_timing(pm, entry, NULL_PTR, timing, &value);
+        
+        PidStats_RecordResponse(&pm->stats, PID_MODE_LIVE_DATA, frame->pid, ecu_header,
+                                latency_ms, frame->data_length, value.timestamp_ms, entry->rate_ms);
+        
+        PidComponentValue_t components[PID_MAX_COMPONENTS];
+        u8 component_count = 0U;
+        
+        if ((def != NULL_PTR) && (def->component_count > 0U)) {
+            component_count = decode_components(def, frame->data, frame->data_length,
+                                                components, PID_MAX_COMPONENTS);
+        }
+        
+        store_value(pm, entry, &value, components, component_count);
+        
+        publish_value(pm, entry, &value);
+        
+        update_virtuals(pm, frame->pid, &value);
+    }
+    
+    return result;
+}
+
+Result_t PidManager_GetValue(const PidManager_t* pm, u8 pid, PidValue_t* value)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (value == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    const PidEntry_t* entry = find_entry(pm, pid);
+    
+    if (entry == NULL_PTR) {
+        value->valid = false;
+        return RESULT_NO_DATA;
+    }
+    
+    if (load_value(entry, value) == false) {
+        value->valid = false;
+        return RESULT_BUSY;
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_GetComponents(const PidManager_t* pm,
+                                  u8 pid,
+                                  PidComponentValue_t* components,
+                                  u8 max_components,
+                                  u8* component_count)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if ((components == NULL_PTR) || (component_count == NULL_PTR)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    *component_count = 0U;
+    
+    const PidEntry_t* entry = find_entry(pm, pid);
+    
+    if (entry == NULL_PTR) {
+        return RESULT_NO_DATA;
+    }
+    
+    for (u8 attempt = 0U; attempt < PID_SEQLOCK_MAX_RETRIES; attempt++) {
+        u32 begin = entry->sequence;
+        atomic_thread_fence(memory_order_acquire);
+        
+        if ((begin & 0x01U) != 0U) {
+            continue;
+        }
+        
+        u8 base = entry->component_base;
+        u8 total = (entry->value.valid == true) ? entry->component_count : 0U;
+        u8 count = (total < max_components) ? total : max_components;
+        
+        for (u8 i = 0U; i < count; i++) {
+            components[i] = pm->component_values[base + i];
+        }
+        
+        atomic_thread_fence(memory_order_acquire);
+        
+        if (entry->sequence == begin) {
+            if (total == 0U) {
+                return RESULT_NO_DATA;
+            }
+            
+            *component_count = count;
+            return RESULT_OK;
+        }
+    }
+    
+    return RESULT_BUSY;
+}
+
+Result_t PidManager_GetSnapshot(const PidManager_t* pm, PidSnapshot_t* snapshot)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (snapshot == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    for (u8 attempt = 0U; attempt < PID_SEQLOCK_MAX_RETRIES; attempt++) {
+        u32 begin = pm->epoch;
+        u8 entry_count = pm->entry_count;
+        atomic_thread_fence(memory_order_acquire);
+        
+        if ((begin & 0x01U) != 0U) {
+            continue;
+        }
+        
+        u8 count = 0U;
+        
+        for (u8 i = 0U; i < entry_count; i++) {
+            const PidEntry_t* entry = &pm->entries[i];
+            
+            if (entry->enabled == true) {
+                snapshot->pids[count] = entry->pid;
+                snapshot->values[count] = entry->value;
+                count++;
+            }
+        }
+        
+        atomic_thread_fence(memory_order_acquire);
+        
+        if (pm->epoch == begin) {
+            snapshot->epoch = begin >> 1U;
+            snapshot->count = count;
+            return RESULT_OK;
+        }
+    }
+    
+    snapshot->count = 0U;
+    
+    return RESULT_BUSY;
+}
+
+Result_t PidManager_GetNextPidToRead(const PidManager_t* pm, u8* pid)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pid == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    const PidEnhancedDefinition_t* enhanced = NULL_PTR;
+    const PidEntry_t* best = select_next_entry(pm, false, &enhanced);
+    
+    if (best == NULL_PTR) {
+        return RESULT_NO_DATA;
+    }
+    
+    *pid = best->pid;
+    return RESULT_OK;
+}
+
+Result_t PidManager_GetNextRequest(const PidManager_t* pm, PidRequest_t* request)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (request == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    const PidEnhancedDefinition_t* enhanced = NULL_PTR;
+    const PidEntry_t* best = select_next_entry(pm, true, &enhanced);
+    
+    if (best == NULL_PTR) {
+        return RESULT_NO_DATA;
+    }
+    
+    if (enhanced != NULL_PTR) {
+        request->mode = enhanced->mode;
+        request->did = enhanced->did;
+        request->ecu_header = enhanced->ecu_header;
+    } else {
+        request->mode = PID_MODE_LIVE_DATA;
+        request->did = best->pid;
+        request->ecu_header = 0U;
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_SetSchedulePolicy(PidManager_t* pm, PidSchedulePolicy_t policy)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (policy >= PID_POLICY_MAX) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    pm->schedule_policy = policy;
+    
+    return RESULT_OK;
+}
+
+PidSchedulePolicy_t PidManager_GetSchedulePolicy(const PidManager_t* pm)
+{
+    if (pm == NULL_PTR) {
+        return PID_POLICY_STRICT;
+    }
+    
+    return pm->schedule_policy;
+}
+
+u32 PidManager_GetScheduleGeneration(const PidManager_t* pm)
+{
+    if (pm == NULL_PTR) {
+        return 0U;
+    }
+    
+    return pm->schedule_generation;
+}
+
+Result_t PidManager_GetScheduledRequests(const PidManager_t* pm,
+                                         PidScheduledRequest_t* requests,
+                                         u8 max_requests,
+                                         u8* request_count)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (requests == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (request_count == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    u8 count = 0U;
+    u8 total = pm->entry_count + pm->enhanced_count;
+    
+    for (u8 i = 0U; i < total; i++) {
+        const PidEntry_t* entry;
+        const PidEnhancedDefinition_t* def = NULL_PTR;
+        
+        if (i < pm->entry_count) {
+            entry = &pm->entries[i];
+        } else {
+            entry = &pm->enhanced_entries[i - pm->entry_count];
+            def = pm->enhanced_defs[i - pm->entry_count];
+        }
+        
+        u16 rate_ms = effective_rate(pm, entry);
+        
+        if (rate_ms == 0U) {
+            continue;
+        }
+        
+        if (count >= max_requests) {
+            *request_count = count;
+            return RESULT_BUFFER_FULL;
+        }
+        
+        PidScheduledRequest_t* out = &requests[count];
+        
+        if (def != NULL_PTR) {
+            out->request.mode = def->mode;
+            out->request.did = def->did;
+            out->request.ecu_header = def->ecu_header;
+        } else {
+            out->request.mode = PID_MODE_LIVE_DATA;
+            out->request.did = entry->pid;
+            out->request.ecu_header = 0U;
+        }
+        
+        out->rate_ms = rate_ms;
+        out->priority = entry_priority(pm, entry, def);
+        count++;
+    }
+    
+    *request_count = count;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_SetClassWeight(PidManager_t* pm, u8 priority, u16 weight)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if ((priority >= PID_PRIORITY_MAX) || (weight == 0U)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    pm->classes[priority].weight = weight;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_GetClassStats(const PidManager_t* pm, u8 priority, PidClassStats_t* stats)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if ((stats == NULL_PTR) || (priority >= PID_PRIORITY_MAX)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    u64 total = 0U;
+    
+    for (u8 c = 0U; c < PID_PRIORITY_MAX; c++) {
+        total += pm->classes[c].requests;
+    }
+    
+    u32 elapsed = Clock_ElapsedMs(pm->clock, pm->class_window_start_us);
+    
+    const PidClassState_t* cls = &pm->classes[priority];
+    stats->weight = cls->weight;
+    stats->requests = cls->requests;
+    stats->share_permille = (total > 0U) ? (u16)(((u64)cls->requests * 1000U) / total) : 0U;
+    stats->requests_per_minute = (elapsed > 0U) ? (u32)(((u64)cls->requests * 60000U) / elapsed) : 0U;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_ResetClassStats(PidManager_t* pm)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    for (u8 c = 0U; c < PID_PRIORITY_MAX; c++) {
+        pm->classes[c].requests = 0U;
+    }
+    
+    pm->class_window_start_us = Clock_NowUs(pm->clock);
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_SetPollProfile(PidManager_t* pm, PidPollProfile_t profile)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (profile >= PID_POLL_MAX) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (pm->poll_profile != profile) {
+        pm->poll_profile = profile;
+        pm->schedule_generation++;
+    }
+    
+    return RESULT_OK;
+}
+
+PidPollProfile_t PidManager_GetPollProfile(const PidManager_t* pm)
+{
+    if (pm == NULL_PTR) {
+        return PID_POLL_FULL;
+    }
+    
+    return pm->poll_profile;
+}
+
+Result_t PidManager_SetKeepAlive(PidManager_t* pm, u8 pid, bool keepalive)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    PidEntry_t* entry = find_or_create_entry(pm, pid);
+    
+    if (entry == NULL_PTR) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    if (entry->keepalive != keepalive) {
+        entry->keepalive = keepalive;
+        pm->schedule_generation++;
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_SetKeepAliveRate(PidManager_t* pm, u16 rate_ms)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (rate_ms == 0U) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (pm->keepalive_rate_ms != rate_ms) {
+        pm->keepalive_rate_ms = rate_ms;
+        pm->schedule_generation++;
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_RegisterEnhanced(PidManager_t* pm, const PidEnhancedDefinition_t* def)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (def == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (find_enhanced_slot(pm, def->mode, def->did, def->ecu_header) != PID_MAX_ENHANCED) {
+        return RESULT_ERROR;
+    }
+    
+    if (pm->enhanced_count >= PID_MAX_ENHANCED) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    u8 slot = pm->enhanced_count;
+    u8 bucket = enhanced_hash(def->mode, def->did, def->ecu_header);
+    
+    while (pm->enhanced_index[bucket] != 0U) {
+        bucket = (u8)((bucket + 1U) & (PID_ENHANCED_HASH_SIZE - 1U));
+    }
+    
+    init_entry(&pm->enhanced_entries[slot], PID_ENTRY_NO_PID);
+    
+    if (reserve_components(pm, &pm->enhanced_entries[slot], component_slots(&def->def)) == false) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    pm->enhanced_defs[slot] = def;
+    pm->enhanced_entries[slot].supported = true;
+    pm->enhanced_entries[slot].rate_ms = def->def.default_rate_ms;
+    pm->enhanced_entries[slot].requested_rate_ms = def->def.default_rate_ms;
+    pm->enhanced_index[bucket] = (u8)(slot + 1U);
+    pm->enhanced_count++;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_RegisterPackEnhanced(PidManager_t* pm, u8 mode, u16 did, u16 ecu_header)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (pm->definition_pack == NULL_PTR) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (pm->pack_enhanced_count >= PID_MAX_ENHANCED) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    PidPackDefinition_t packed;
+    
+    if (PidPack_Find(pm->definition_pack, mode, did, &packed) != RESULT_OK) {
+        return RESULT_NO_DATA;
+    }
+    
+    PidEnhancedDefinition_t* enhanced = &pm->pack_enhanced[pm->pack_enhanced_count];
+    
+    if (unpack_definition(&packed, PID_ENTRY_NO_PID, &enhanced->def) == false) {
+        return RESULT_ERROR;
+    }
+    
+    enhanced->mode = mode;
+    enhanced->did = did;
+    enhanced->ecu_header = ecu_header;
+    
+    Result_t result = PidManager_RegisterEnhanced(pm, enhanced);
+    
+    if (result == RESULT_OK) {
+        pm->pack_enhanced_count++;
+    }
+    
+    return result;
+}
+
+const PidEnhancedDefinition_t* PidManager_FindEnhanced(const PidManager_t* pm, u8 mode, u16 did, u16 ecu_header)
+{
+    if (pm == NULL_PTR) {
+        return NULL_PTR;
+    }
+    
+    u8 slot = find_enhanced_slot(pm, mode, did, ecu_header);
+    
+    if (slot == PID_MAX_ENHANCED) {
+        return NULL_PTR;
+    }
+    
+    return pm->enhanced_defs[slot];
+}
+
+Result_t PidManager_EnableEnhanced(PidManager_t* pm, u8 mode, u16 did, u16 ecu_header, u16 rate_ms)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    u8 slot = find_enhanced_slot(pm, mode, did, ecu_header);
+    
+    if (slot == PID_MAX_ENHANCED) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    PidEntry_t* entry = &pm->enhanced_entries[slot];
+    entry->requested = true;
+    entry->requested_rate_ms = rate_ms;
+    entry->enabled = true;
+    entry->rate_ms = rate_ms;
+    pm->schedule_generation++;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_DisableEnhanced(PidManager_t* pm, u8 mode, u16 did, u16 ecu_header)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    u8 slot = find_enhanced_slot(pm, mode, did, ecu_header);
+    
+    if (slot == PID_MAX_ENHANCED) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    pm->enhanced_entries[slot].requested = false;
+    pm->enhanced_entries[slot].enabled = false;
+    pm->schedule_generation++;
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_ProcessEnhancedResponse(PidManager_t* pm,
+                                            u8 mode,
+                                            u16 did,
+                                            u16 ecu_header,
+                                            const u8* data,
+                                            u8 data_len)
+{
+    return PidManager_ProcessEnhancedResponseTimed(pm, mode, did, ecu_header, data, data_len, NULL_PTR);
+}
+
+Result_t PidManager_ProcessEnhancedResponseTimed(PidManager_t* pm,
+                                                 u8 mode,
+                                                 u16 did,
+                                                 u16 ecu_header,
+                                                 const u8* data,
+                                                 u8 data_len,
+                                                 const PidFrameTiming_t* timing)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (data == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    u8 slot = find_enhanced_slot(pm, mode, did, ecu_header);
+    
+    if (slot == PID_MAX_ENHANCED) {
+        return RESULT_NO_DATA;
+    }
+    
+    const PidEnhancedDefinition_t* enhanced = pm->enhanced_defs[slot];
+    PidEntry_t* entry = &pm->enhanced_entries[slot];
+    
+    PidValue_t value;
+    value.timestamp_ms = 0U;
+    value.rx_time_us = 0U;
+    value.request_time_us = 0U;
+    value.valid = false;
+    Result_t result = convert_with_definition(&enhanced->def, data, data_len, &value);
+    
+    if (result != RESULT_OK) {
+        PidStats_RecordDecodeFailure(&pm->stats, mode, did, ecu_header);
+        return result;
+    }
+    
+    u32 latency_ms = apply_frame_timing(pm, entry, enhanced, timing, &value);
+    
+    PidStats_RecordResponse(&pm->stats, mode, did, ecu_header,
+                            latency_ms, data_len, value.timestamp_ms, entry->rate_ms);
+    
+    PidComponentValue_t components[PID_MAX_COMPONENTS];
+    u8 component_count = 0U;
+    
+    if (enhanced->def.component_count > 0U) {
+        component_count = decode_components(&enhanced->def, data, data_len,
+                                            components, PID_MAX_COMPONENTS);
+    }
+    
+    store_value(pm, entry, &value, components, component_count);
+    
+    if ((record_notification(pm, entry, &value) == true) && (pm->enhanced_callback != NULL_PTR)) {
+        pm->enhanced_callback(enhanced, &value, pm->callback_context);
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_GetEnhancedValue(const PidManager_t* pm, u8 mode, u16 did, u16 ecu_header, PidValue_t* value)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (value == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    u8 slot = find_enhanced_slot(pm, mode, did, ecu_header);
+    
+    if (slot == PID_MAX_ENHANCED) {
+        value->valid = false;
+        return RESULT_NO_DATA;
+    }
+    
+    if (load_value(&pm->enhanced_entries[slot], value) == false) {
+        value->valid = false;
+        return RESULT_BUSY;
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_OnRequestSent(PidManager_t* pm, const PidRequest_t* request)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (request == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    PidEntry_t* entry = find_request_entry(pm, request);
+    
+    if (entry == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    entry->request_sent_us = Clock_NowUs(pm->clock);
+    entry->request_pending = true;
+    entry->request_count++;
+    
+    charge_request(pm, entry, PidManager_FindEnhanced(pm, request->mode, request->did, request->ecu_header));
+    
+    return RESULT_OK;
+}
+
+Result_t PidManager_OnNoData(PidManager_t* pm, const PidRequest_t* request)
+{
+    if (pm == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (request == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pm->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    PidEntry_t* entry = find_request_entry(pm, request);
+    
+    if (entry != NULL_PTR) {
+        entry->request_pending = false;
+    }
+    
+    return PidStats_RecordNoData(&pm->stats, request->mode, request->did, request->ecu_header);
+}
+
+const PidStats_t* PidManager_GetStats(const PidManager_t* pm)
+{
+    if (pm == NULL_PTR) {
+        return NULL_PTR;
+    }
+    
+    if (pm->initialized == false) {
+        return NULL_PTR;
+    }
+    
+    return &pm->stats;
+}
+
+u32 PidManager_GetRequestCount(const PidManager_t* pm, const PidRequest_t* request)
+{
+    if ((pm == NULL_PTR) || (request == NULL_PTR)) {
+        return 0U;
     }
     
-    for (u8 i = 0U; i < 32U; i++) {
-        pm->supported_pids[i] = 0U;
+    if (request->mode == PID_MODE_LIVE_DATA) {
+        const PidEntry_t* entry = (request->did <= 0xFFU) ? find_entry(pm, (u8)request->did) : NULL_PTR;
+        return (entry != NULL_PTR) ? entry->request_count : 0U;
     }
     
-    pm->entry_count = 0U;
-    pm->error_handler = config->error_handler;
-    pm->value_callback = config->value_callback;
-    pm->callback_context = config->callback_context;
-    pm->get_timestamp_ms = config->get_timestamp_ms;
-    pm->initialized = true;
+    u8 slot = find_enhanced_slot(pm, request->mode, request->did, request->ecu_header);
     
-    return RESULT_OK;
+    if (slot == PID_MAX_ENHANCED) {
+        return 0U;
+    }
+    
+    return pm->enhanced_entries[slot].request_count;
 }
 
-Result_t PidManager_SetSupported(PidManager_t* pm, const u8* supported_data, u8 start_pid)
+const PidDefinition_t* PidManager_GetDefinition(u8 pid)
+{
+    return find_pid_definition(pid);
+}
+
+Result_t PidManager_EnableVirtual(PidManager_t* pm, u8 virtual_id, u16 rate_ms)
 {
     if (pm == NULL_PTR) {
         return RESULT_INVALID_PARAM;
     }
     
-    if (supported_data == NULL_PTR) {
+    if (virtual_id >= VIRTUAL_DEFINITIONS_COUNT) {
         return RESULT_INVALID_PARAM;
     }
     
@@ -154,332 +2591,375 @@ Result_t PidManager_SetSupported(PidManager_t* pm, const u8* supported_data, u8
         return RESULT_NOT_READY;
     }
     
-    for (u8 byte_idx = 0U; byte_idx < 4U; byte_idx++) {
-        for (u8 bit_idx = 0U; bit_idx < 8U; bit_idx++) {
-            u8 pid = start_pid + (byte_idx * 8U) + bit_idx + 1U;
-            bool supported = ((supported_data[byte_idx] >> (7U - bit_idx)) & 0x01U) != 0U;
-            
-            u8 byte_pos = pid / 8U;
-            u8 bit_pos = pid % 8U;
-            
-            if (byte_pos < 32U) {
-                if (supported) {
-                    pm->supported_pids[byte_pos] |= (1U << bit_pos);
-                } else {
-                    pm->supported_pids[byte_pos] &= ~(1U << bit_pos);
-                }
-                
-                if (supported) {
-                    PidEntry_t* entry = find_or_create_entry(pm, pid);
-                    if (entry != NULL_PTR) {
-                        entry->supported = true;
-                        
-                        const PidDefinition_t* def = find_pid_definition(pid);
-                        if (def != NULL_PTR) {
-                            entry->rate_ms = def->default_rate_ms;
-                        }
-                    }
-                }
-            }
+    const PidVirtualDefinition_t* vdef = &virtual_definitions[virtual_id];
+    
+    for (u8 i = 0U; i < vdef->input_count; i++) {
+        if (find_or_create_entry(pm, vdef->inputs[i]) == NULL_PTR) {
+            return RESULT_BUFFER_FULL;
         }
     }
     
+    PidEntry_t* ventry = &pm->virtual_entries[virtual_id];
+    ventry->requested = true;
+    ventry->requested_rate_ms = rate_ms;
+    ventry->enabled = true;
+    ventry->rate_ms = rate_ms;
+    
+    rebuild_schedule(pm);
+    
     return RESULT_OK;
 }
 
-bool PidManager_IsSupported(const PidManager_t* pm, u8 pid)
+Result_t PidManager_DisableVirtual(PidManager_t* pm, u8 virtual_id)
 {
     if (pm == NULL_PTR) {
-        return false;
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (virtual_id >= VIRTUAL_DEFINITIONS_COUNT) {
+        return RESULT_INVALID_PARAM;
     }
     
     if (pm->initialized == false) {
-        return false;
+        return RESULT_NOT_READY;
     }
     
-    u8 byte_pos = pid / 8U;
-    u8 bit_pos = pid % 8U;
+    PidEntry_t* ventry = &pm->virtual_entries[virtual_id];
+    ventry->requested = false;
+    ventry->enabled = false;
+    ventry->rate_ms = 0U;
     
-    if (byte_pos >= 32U) {
-        return false;
-    }
+    rebuild_schedule(pm);
     
-    return ((pm->supported_pids[byte_pos] >> bit_pos) & 0x01U) != 0U;
+    return RESULT_OK;
 }
 
-Result_t PidManager_EnablePid(PidManager_t* pm, u8 pid, u16 rate_ms)
+Result_t PidManager_GetVirtualValue(const PidManager_t* pm, u8 virtual_id, PidValue_t* value)
 {
     if (pm == NULL_PTR) {
         return RESULT_INVALID_PARAM;
     }
     
+    if (value == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (virtual_id >= VIRTUAL_DEFINITIONS_COUNT) {
+        return RESULT_INVALID_PARAM;
+    }
+    
     if (pm->initialized == false) {
         return RESULT_NOT_READY;
     }
     
-    PidEntry_t* entry = find_or_create_entry(pm, pid);
-    
-    if (entry == NULL_PTR) {
-        return RESULT_BUFFER_FULL;
+    if (load_value(&pm->virtual_entries[virtual_id], value) == false) {
+        value->valid = false;
+        return RESULT_BUSY;
     }
     
-    entry->enabled = true;
-    entry->rate_ms = rate_ms;
+    u32 now_ms = CLOCK_US_TO_MS(Clock_NowUs(pm->clock));
+    
+    if ((value->valid == true) &&
+        (virtual_inputs_fresh(pm, &virtual_definitions[virtual_id], now_ms, NULL_PTR) == false)) {
+        value->valid = false;
+    }
     
     return RESULT_OK;
 }
 
-Result_t PidManager_DisablePid(PidManager_t* pm, u8 pid)
+const PidVirtualDefinition_t* PidManager_GetVirtualDefinition(u8 virtual_id)
 {
-    if (pm == NULL_PTR) {
-        return RESULT_INVALID_PARAM;
-    }
-    
-    if (pm->initialized == false) {
-        return RESULT_NOT_READY;
+    if (virtual_id >= VIRTUAL_DEFINITIONS_COUNT) {
+        return NULL_PTR;
     }
     
-    for (u8 i = 0U; i < pm->entry_count; i++) {
-        if (pm->entries[i].pid == pid) {
-            pm->entries[i].enabled = false;
-            return RESULT_OK;
-        }
+    return &virtual_definitions[virtual_id];
+}
+
+u32 PidManager_GetDefinitionCount(void)
+{
+    return (u32)PID_DEFINITIONS_COUNT;
+}
+
+const PidDefinition_t* PidManager_GetDefinitionAt(u32 index)
+{
+    if (index >= PID_DEFINITIONS_COUNT) {
+        return NULL_PTR;
     }
     
-    return RESULT_OK;
+    return &pid_definitions[index];
 }
 
-Result_t PidManager_SetRate(PidManager_t* pm, u8 pid, u16 rate_ms)
+Result_t PidManager_ConvertRawToEng(u8 pid, const u8* raw_data, u8 data_len, PidValue_t* value)
 {
-    if (pm == NULL_PTR) {
+    if (raw_data == NULL_PTR) {
         return RESULT_INVALID_PARAM;
     }
     
-    if (pm->initialized == false) {
-        return RESULT_NOT_READY;
+    if (value == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
     }
     
-    for (u8 i = 0U; i < pm->entry_count; i++) {
-        if (pm->entries[i].pid == pid) {
-            pm->entries[i].rate_ms = rate_ms;
-            return RESULT_OK;
+    value->valid = false;
+    
+    const PidDefinition_t* def = find_pid_definition(pid);
+    
+    if (def == NULL_PTR) {
+        if (data_len >= 1U) {
+            value->raw_value = (i32)raw_data[0];
+            value->eng_value = (float)raw_data[0];
+            value->unit = PID_UNIT_NONE;
+            value->valid = true;
         }
+        return RESULT_OK;
     }
     
-    return RESULT_ERROR;
+    return convert_with_definition(def, raw_data, data_len, value);
 }
 
-Result_t PidManager_ProcessFrame(PidManager_t* pm, const Obd2Frame_t* frame)
+Result_t PidManager_ConvertRawToFixed(u8 pid, const u8* raw_data, u8 data_len, PidFixedValue_t* value)
 {
-    if (pm == NULL_PTR) {
+    if (raw_data == NULL_PTR) {
         return RESULT_INVALID_PARAM;
     }
     
-    if (frame == NULL_PTR) {
+    if (value == NULL_PTR) {
         return RESULT_INVALID_PARAM;
     }
     
-    if (pm->initialized == false) {
-        return RESULT_NOT_READY;
-    }
+    value->valid = false;
     
-    if (frame->valid == false) {
-        return RESULT_INVALID_PARAM;
-    }
+    const PidDefinition_t* def = find_pid_definition(pid);
     
-    if (frame->mode != OBD2_MODE_01_LIVE_DATA) {
+    if (def == NULL_PTR) {
+        if (data_len >= 1U) {
+            value->raw_value = (i32)raw_data[0];
+            value->eng_fixed = (i32)raw_data[0];
+            value->scale = 1U;
+            value->unit = PID_UNIT_NONE;
+            value->valid = true;
+        }
         return RESULT_OK;
     }
     
-    PidEntry_t* entry = find_or_create_entry(pm, frame->pid);
-    
-    if (entry == NULL_PTR) {
-        return RESULT_BUFFER_FULL;
+    if (data_len < def->data_bytes) {
+        return RESULT_ERROR;
     }
     
-    PidValue_t value;
-    Result_t result = PidManager_ConvertRawToEng(frame->pid, frame->data, frame->data_length, &value);
+    i32 raw = decode_raw(def, raw_data);
     
-    if (result == RESULT_OK) {
-        if (pm->get_timestamp_ms != NULL_PTR) {
-            value.timestamp_ms = pm->get_timestamp_ms();
-            entry->last_read_ms = value.timestamp_ms;
-        }
-        
-        entry->value = value;
-        
-        if (pm->value_callback != NULL_PTR) {
-            pm->value_callback(frame->pid, &value, pm->callback_context);
-        }
-    }
+    value->raw_value = raw;
+    value->eng_fixed = scale_fixed(def, raw);
+    value->scale = def->scale_den;
+    value->unit = def->unit;
+    value->valid = true;
     
-    return result;
+    return RESULT_OK;
 }
 
-Result_t PidManager_GetValue(const PidManager_t* pm, u8 pid, PidValue_t* value)
+float PidManager_FixedToFloat(const PidFixedValue_t* value)
 {
-    if (pm == NULL_PTR) {
-        return RESULT_INVALID_PARAM;
+    if ((value == NULL_PTR) || (value->scale == 0U)) {
+        return 0.0f;
     }
     
-    if (value == NULL_PTR) {
+    return (float)value->eng_fixed / (float)value->scale;
+}
+
+Result_t PidManager_DecodeComponents(u8 pid,
+                                     const u8* raw_data,
+                                     u8 data_len,
+                                     PidComponentValue_t* components,
+                                     u8 max_components,
+                                     u8* component_count)
+{
+    if ((raw_data == NULL_PTR) || (components == NULL_PTR) || (component_count == NULL_PTR)) {
         return RESULT_INVALID_PARAM;
     }
     
-    if (pm->initialized == false) {
-        return RESULT_NOT_READY;
-    }
+    *component_count = 0U;
     
-    const PidEntry_t* entry = find_entry(pm, pid);
+    const PidDefinition_t* def = find_pid_definition(pid);
     
-    if (entry == NULL_PTR) {
-        value->valid = false;
+    if ((def == NULL_PTR) || (def->component_count == 0U)) {
         return RESULT_NO_DATA;
     }
     
-    *value = entry->value;
+    if (data_len < def->data_bytes) {
+        return RESULT_ERROR;
+    }
+    
+    *component_count = decode_components(def, raw_data, data_len, components, max_components);
     
     return RESULT_OK;
 }
 
-Result_t PidManager_GetNextPidToRead(const PidManager_t* pm, u8* pid)
+Result_t PidManager_ConvertColumn(u8 pid,
+                                  const u8* raw_bytes,
+                                  u8 stride,
+                                  const u32* timestamps_ms,
+                                  u32 count,
+                                  const PidBatchOutput_t* output)
 {
-    if (pm == NULL_PTR) {
+    if ((raw_bytes == NULL_PTR) || (output == NULL_PTR)) {
         return RESULT_INVALID_PARAM;
     }
     
-    if (pid == NULL_PTR) {
+    if ((output->raw_values == NULL_PTR) || (output->eng_values == NULL_PTR)) {
         return RESULT_INVALID_PARAM;
     }
     
-    if (pm->initialized == false) {
-        return RESULT_NOT_READY;
+    const PidDefinition_t* def = find_pid_definition(pid);
+    u8 data_bytes = (def != NULL_PTR) ? def->data_bytes : 1U;
+    
+    if (stride == 0U) {
+        stride = data_bytes;
     }
     
-    u32 current_time = 0U;
-    if (pm->get_timestamp_ms != NULL_PTR) {
-        current_time = pm->get_timestamp_ms();
+    if (stride < data_bytes) {
+        return RESULT_INVALID_PARAM;
     }
     
-    u8 best_pid = 0xFFU;
-    u8 best_priority = PID_PRIORITY_MAX;
-    u32 best_overdue = 0U;
+    if (def == NULL_PTR) {
+        decode_column_u8(raw_bytes, stride, count, output->raw_values);
+        scale_column(output->raw_values, count, 1.0f, 0.0f, output->eng_values);
+    } else {
+        decode_column(def->data_type, raw_bytes, stride, count, output->raw_values);
+        scale_column(output->raw_values, count, def->scale, def->offset, output->eng_values);
+    }
     
-    for (u8 i = 0U; i < pm->entry_count; i++) {
-        const PidEntry_t* entry = &pm->entries[i];
-        
-        if ((entry->enabled == false) || (entry->rate_ms == 0U)) {
-            continue;
+    if ((timestamps_ms != NULL_PTR) && (output->timestamps_ms != NULL_PTR)) {
+        for (u32 i = 0U; i < count; i++) {
+            output->timestamps_ms[i] = timestamps_ms[i];
         }
+    }
+    
+    return RESULT_OK;
+}
+
+static Result_t convert_batch_chunk(const u8* pids,
+                                    const u8* raw_bytes,
+                                    u32 count,
+                                    i32* raw_values,
+                                    float* eng_values,
+                                    u16* bucket_of)
+{
+    u8 bucket_pid[PID_MAX_COUNT];
+    u16 bucket_start[PID_MAX_COUNT + 1];
+    u16 fill[PID_MAX_COUNT];
+    u16 order[PID_BATCH_CHUNK];
+    u8 sorted_raw[PID_BATCH_CHUNK * PID_BATCH_RAW_STRIDE];
+    i32 sorted_values[PID_BATCH_CHUNK];
+    float sorted_eng[PID_BATCH_CHUNK];
+    u16 bucket_count = 0U;
+    
+    bucket_start[0] = 0U;
+    
+    for (u32 i = 0U; i < count; i++) {
+        u8 pid = pids[i];
         
-        u32 elapsed;
-        if (current_time >= entry->last_read_ms) {
-            elapsed = current_time - entry->last_read_ms;
-        } else {
-            elapsed = (0xFFFFFFFFU - entry->last_read_ms) + current_time + 1U;
+        if (bucket_of[pid] == PID_BATCH_NO_BUCKET) {
+            bucket_of[pid] = bucket_count;
+            bucket_pid[bucket_count] = pid;
+            bucket_start[bucket_count + 1U] = 0U;
+            bucket_count++;
         }
         
-        if (elapsed >= entry->rate_ms) {
-            const PidDefinition_t* def = find_pid_definition(entry->pid);
-            u8 priority = (def != NULL_PTR) ? def->priority : PID_PRIORITY_LOW;
-            
-            u32 overdue = elapsed - entry->rate_ms;
-            
-            if ((priority < best_priority) || 
-                ((priority == best_priority) && (overdue > best_overdue))) {
-                best_pid = entry->pid;
-                best_priority = priority;
-                best_overdue = overdue;
-            }
+        bucket_start[bucket_of[pid] + 1U]++;
+    }
+    
+    for (u16 b = 0U; b < bucket_count; b++) {
+        bucket_start[b + 1U] = (u16)(bucket_start[b + 1U] + bucket_start[b]);
+        fill[b] = bucket_start[b];
+    }
+    
+    for (u32 i = 0U; i < count; i++) {
+        u16 slot = fill[bucket_of[pids[i]]]++;
+        order[slot] = (u16)i;
+        memcpy(&sorted_raw[slot * PID_BATCH_RAW_STRIDE], &raw_bytes[i * PID_BATCH_RAW_STRIDE], PID_BATCH_RAW_STRIDE);
+    }
+    
+    PidBatchOutput_t bucket_output;
+    bucket_output.timestamps_ms = NULL_PTR;
+    Result_t result = RESULT_OK;
+    
+    for (u16 b = 0U; b < bucket_count; b++) {
+        u16 start = bucket_start[b];
+        
+        bucket_of[bucket_pid[b]] = PID_BATCH_NO_BUCKET;
+        
+        if (result != RESULT_OK) {
+            continue;
         }
+        
+        bucket_output.raw_values = &sorted_values[start];
+        bucket_output.eng_values = &sorted_eng[start];
+        
+        result = PidManager_ConvertColumn(bucket_pid[b],
+                                          &sorted_raw[start * PID_BATCH_RAW_STRIDE],
+                                          PID_BATCH_RAW_STRIDE,
+                                          NULL_PTR,
+                                          (u32)(bucket_start[b + 1U] - start),
+                                          &bucket_output);
     }
     
-    if (best_pid == 0xFFU) {
-        return RESULT_NO_DATA;
+    if (result != RESULT_OK) {
+        return result;
+    }
+    
+    for (u32 i = 0U; i < count; i++) {
+        raw_values[order[i]] = sorted_values[i];
+        eng_values[order[i]] = sorted_eng[i];
     }
     
-    *pid = best_pid;
     return RESULT_OK;
 }
 
-const PidDefinition_t* PidManager_GetDefinition(u8 pid)
-{
-    return find_pid_definition(pid);
-}
-
-Result_t PidManager_ConvertRawToEng(u8 pid, const u8* raw_data, u8 data_len, PidValue_t* value)
+Result_t PidManager_ConvertBatch(const u8* pids,
+                                 const u8* raw_bytes,
+                                 const u32* timestamps_ms,
+                                 u32 count,
+                                 const PidBatchOutput_t* output)
 {
-    if (raw_data == NULL_PTR) {
+    if ((pids == NULL_PTR) || (raw_bytes == NULL_PTR) || (output == NULL_PTR)) {
         return RESULT_INVALID_PARAM;
     }
     
-    if (value == NULL_PTR) {
+    if ((output->raw_values == NULL_PTR) || (output->eng_values == NULL_PTR)) {
         return RESULT_INVALID_PARAM;
     }
     
-    value->valid = false;
-    
-    const PidDefinition_t* def = find_pid_definition(pid);
+    u16 bucket_of[PID_MAX_COUNT];
     
-    if (def == NULL_PTR) {
-        if (data_len >= 1U) {
-            value->raw_value = (i32)raw_data[0];
-            value->eng_value = (float)raw_data[0];
-            value->unit = PID_UNIT_NONE;
-            value->valid = true;
-        }
-        return RESULT_OK;
+    for (u16 pid = 0U; pid < PID_MAX_COUNT; pid++) {
+        bucket_of[pid] = PID_BATCH_NO_BUCKET;
     }
     
-    if (data_len < def->data_bytes) {
-        return RESULT_ERROR;
+    for (u32 chunk_start = 0U; chunk_start < count; chunk_start += PID_BATCH_CHUNK) {
+        u32 chunk_count = count - chunk_start;
+        
+        if (chunk_count > PID_BATCH_CHUNK) {
+            chunk_count = PID_BATCH_CHUNK;
+        }
+        
+        Result_t result = convert_batch_chunk(&pids[chunk_start],
+                                              &raw_bytes[chunk_start * PID_BATCH_RAW_STRIDE],
+                                              chunk_count,
+                                              &output->raw_values[chunk_start],
+                                              &output->eng_values[chunk_start],
+                                              bucket_of);
+        
+        if (result != RESULT_OK) {
+            return result;
+        }
     }
     
-    i32 raw = 0;
-    
-    switch (def->data_type) {
-        case PID_DATA_U8:
-            raw = (i32)raw_data[0];
-            break;
-            
-        case PID_DATA_U16:
-            raw = (i32)(((u16)raw_data[0] << 8U) | (u16)raw_data[1]);
-            break;
-            
-        case PID_DATA_U32:
-            raw = (i32)(((u32)raw_data[0] << 24U) | 
-                        ((u32)raw_data[1] << 16U) |
-                        ((u32)raw_data[2] << 8U) | 
-                        (u32)raw_data[3]);
-            break;
-            
-        case PID_DATA_I8:
-            raw = (i32)(i8)raw_data[0];
-            break;
-            
-        case PID_DATA_I16:
-            raw = (i32)(i16)(((u16)raw_data[0] << 8U) | (u16)raw_data[1]);
-            break;
-            
-        case PID_DATA_BITFIELD:
-            raw = (i32)(((u32)raw_data[0] << 24U) | 
-                        ((u32)raw_data[1] << 16U) |
-                        ((u32)raw_data[2] << 8U) | 
-                        (u32)raw_data[3]);
-            break;
-            
-        case PID_DATA_FLOAT:
-        case PID_DATA_MAX:
-        default:
-            raw = (i32)raw_data[0];
-            break;
+    if ((timestamps_ms != NULL_PTR) && (output->timestamps_ms != NULL_PTR)) {
+        for (u32 i = 0U; i < count; i++) {
+            output->timestamps_ms[i] = timestamps_ms[i];
+        }
     }
     
-    value->raw_value = raw;
-    value->eng_value = ((float)raw * def->scale) + def->offset;
-    value->unit = def->unit;
-    value->valid = true;
-    
     return RESULT_OK;
 }
 
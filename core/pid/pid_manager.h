@@ -4,13 +4,68 @@
 #include "../types.h"
 #include "../obd2/obd2.h"
 #include "../error/error_handler.h"
+#include "../pid_pack/pid_pack.h"
+#include "../pid_stats/pid_stats.h"
+#include "../clock/clock.h"
 
 #define PID_SUPPORTED_BYTES 4
+#define PID_SUPPORTED_WORDS 8
+#define PID_SUPPORTED_RANGE_STEP 0x20
+#define PID_DISCOVERY_MAX_BATCH 6
+#define PID_SUPPORT_CACHE_SIZE 4
+#define PID_CACHE_VIN_LENGTH 17
 #define PID_MAX_COUNT 256
 #define PID_PRIORITY_HIGH 0
 #define PID_PRIORITY_MEDIUM 1
 #define PID_PRIORITY_LOW 2
 #define PID_PRIORITY_MAX 3
+#define PID_MASK_BYTES 32
+#define PID_MAX_SUBSCRIBERS 8
+#define PID_MAX_ENTRIES 64
+#define PID_ENTRY_NO_PID 0xFF
+#define PID_SEQLOCK_MAX_RETRIES 8
+#define PID_BATCH_RAW_STRIDE 4
+#define PID_BATCH_CHUNK 512
+#define PID_BATCH_NO_BUCKET 0xFFFFU
+#define PID_MAX_COMPONENTS 4
+#define PID_COMPONENT_TABLE_SIZE 64
+#define PID_VIRTUAL_MAX_INPUTS 4
+#define PID_VIRTUAL_FUEL_ECONOMY 0
+#define PID_VIRTUAL_BOOST 1
+#define PID_VIRTUAL_ENGINE_POWER 2
+#define PID_VIRTUAL_COUNT 3
+#define PID_MAX_ENHANCED 16
+#define PID_ENHANCED_HASH_SIZE 32
+#define PID_MODE_LIVE_DATA 0x01
+#define PID_MODE_ENHANCED 0x22
+#define PID_ENGINE_RPM 0x0C
+#define PID_VEHICLE_SPEED 0x0D
+#define PID_KEEPALIVE_RATE_MS 5000
+#define PID_FAIR_COST_SCALE 1000
+#define PID_FAIR_WEIGHT_HIGH 6
+#define PID_FAIR_WEIGHT_MEDIUM 3
+#define PID_FAIR_WEIGHT_LOW 1
+
+#define PID_SCALE(num, den) ((float)(num) / (float)(den)), (num), (den)
+#define PID_OFFSET(offset) ((float)(offset)), ((i32)(offset))
+#define PID_COMPONENTS(table) (table), ((u8)(sizeof(table) / sizeof((table)[0])))
+#define PID_NO_COMPONENTS NULL_PTR, 0U
+
+#if ((PID_ENHANCED_HASH_SIZE & (PID_ENHANCED_HASH_SIZE - 1)) != 0) || (PID_ENHANCED_HASH_SIZE > 256)
+#error "PID_ENHANCED_HASH_SIZE must be a power of two no larger than 256"
+#endif
+
+#if (PID_ENHANCED_HASH_SIZE < PID_MAX_ENHANCED)
+#error "PID_ENHANCED_HASH_SIZE must hold PID_MAX_ENHANCED entries"
+#endif
+
+#if (PID_BATCH_CHUNK > 0xFFFF)
+#error "PID_BATCH_CHUNK must fit the u16 batch ordering"
+#endif
+
+#if (PID_COMPONENT_TABLE_SIZE > 255)
+#error "PID_COMPONENT_TABLE_SIZE must fit the u8 component base"
+#endif
 
 typedef enum {
     PID_UNIT_NONE = 0,
@@ -31,6 +86,8 @@ typedef enum {
     PID_UNIT_MA = 15,
     PID_UNIT_NM = 16,
     PID_UNIT_LPH = 17,
+    PID_UNIT_KM_PER_L = 18,
+    PID_UNIT_KW = 19,
     PID_UNIT_MAX
 } PidUnit_t;
 
@@ -45,14 +102,75 @@ typedef enum {
     PID_DATA_MAX
 } PidDataType_t;
 
+typedef enum {
+    PID_POLL_FULL = 0,
+    PID_POLL_KEEPALIVE = 1,
+    PID_POLL_MAX
+} PidPollProfile_t;
+
+typedef enum {
+    PID_POLICY_STRICT = 0,
+    PID_POLICY_WEIGHTED_FAIR = 1,
+    PID_POLICY_MAX
+} PidSchedulePolicy_t;
+
+typedef enum {
+    PID_NOTIFY_ALWAYS = 0,
+    PID_NOTIFY_ON_CHANGE = 1,
+    PID_NOTIFY_DEADBAND_ABS = 2,
+    PID_NOTIFY_DEADBAND_REL = 3,
+    PID_NOTIFY_MAX
+} PidNotifyMode_t;
+
+typedef struct {
+    PidNotifyMode_t mode;
+    float deadband;
+    u16 min_interval_ms;
+} PidNotifyPolicy_t;
+
 typedef struct {
     i32 raw_value;
     float eng_value;
     PidUnit_t unit;
     u32 timestamp_ms;
+    u64 rx_time_us;
+    u64 request_time_us;
     bool valid;
 } PidValue_t;
 
+typedef struct {
+    u64 request_time_us;
+    u64 rx_time_us;
+} PidFrameTiming_t;
+
+typedef struct {
+    i32 raw_value;
+    i32 eng_fixed;
+    u16 scale;
+    PidUnit_t unit;
+    u32 timestamp_ms;
+    bool valid;
+} PidFixedValue_t;
+
+typedef struct {
+    const char* short_name;
+    PidUnit_t unit;
+    u8 byte_offset;
+    u8 byte_count;
+    u8 bit_offset;
+    u8 bit_count;
+    float scale;
+    u16 scale_num;
+    u16 scale_den;
+    float offset;
+    i32 offset_int;
+} PidComponent_t;
+
+typedef struct {
+    u32 raw_value;
+    float eng_value;
+} PidComponentValue_t;
+
 typedef struct {
     u8 pid;
     const char* name;
@@ -63,62 +181,356 @@ typedef struct {
     float min_value;
     float max_value;
     float scale;
+    u16 scale_num;
+    u16 scale_den;
     float offset;
+    i32 offset_int;
     u8 priority;
     u16 default_rate_ms;
+    const PidComponent_t* components;
+    u8 component_count;
 } PidDefinition_t;
 
+typedef bool (*PidVirtualCompute_t)(const float* inputs, float* output);
+
+typedef struct {
+    u8 id;
+    const char* name;
+    const char* short_name;
+    PidUnit_t unit;
+    u8 inputs[PID_VIRTUAL_MAX_INPUTS];
+    u8 input_count;
+    u16 max_input_age_ms;
+    PidVirtualCompute_t compute;
+} PidVirtualDefinition_t;
+
 typedef struct {
     u8 pid;
     bool supported;
     bool enabled;
     u16 rate_ms;
-    u32 last_read_ms;
+    bool requested;
+    u16 requested_rate_ms;
+    u64 last_read_us;
+    u64 request_sent_us;
+    bool request_pending;
+    u32 request_count;
+    bool keepalive;
+    volatile u32 sequence;
     PidValue_t value;
+    u8 component_base;
+    u8 component_count;
+    PidNotifyPolicy_t notify_policy;
+    bool notified_once;
+    i32 last_notified_raw;
+    float last_notified_eng;
+    u32 last_notify_ms;
+    u32 notify_count;
+    u32 suppressed_count;
 } PidEntry_t;
 
+typedef struct {
+    u8 mode;
+    u16 did;
+    u16 ecu_header;
+    PidDefinition_t def;
+} PidEnhancedDefinition_t;
+
+typedef struct {
+    u8 mode;
+    u16 did;
+    u16 ecu_header;
+} PidRequest_t;
+
+typedef struct {
+    PidRequest_t request;
+    u16 rate_ms;
+    u8 priority;
+} PidScheduledRequest_t;
+
 typedef void (*PidValueCallback_t)(u8 pid, const PidValue_t* value, void* context);
 
+typedef void (*PidEnhancedCallback_t)(const PidEnhancedDefinition_t* def, const PidValue_t* value, void* context);
+
+typedef void (*PidVirtualCallback_t)(const PidVirtualDefinition_t* def, const PidValue_t* value, void* context);
+
+typedef struct {
+    u8 pid_mask[PID_MASK_BYTES];
+    u16 rate_ms;
+    PidValueCallback_t callback;
+    void* context;
+    bool active;
+} PidSubscription_t;
+
+typedef struct {
+    i32* raw_values;
+    float* eng_values;
+    u32* timestamps_ms;
+} PidBatchOutput_t;
+
+typedef struct {
+    u32 epoch;
+    u8 count;
+    u8 pids[PID_MAX_ENTRIES];
+    PidValue_t values[PID_MAX_ENTRIES];
+} PidSnapshot_t;
+
+typedef struct {
+    u16 weight;
+    u32 virtual_time;
+    u32 requests;
+} PidClassState_t;
+
+typedef struct {
+    u16 weight;
+    u32 requests;
+    u16 share_permille;
+    u32 requests_per_minute;
+} PidClassStats_t;
+
+typedef struct {
+    u8 next_range;
+    u8 batch[PID_DISCOVERY_MAX_BATCH];
+    u8 batch_count;
+    u8 received_mask;
+    u8 continuation_mask;
+    bool active;
+    bool complete;
+} PidDiscovery_t;
+
+typedef struct {
+    char vin[PID_CACHE_VIN_LENGTH + 1];
+    u32 supported_map[PID_SUPPORTED_WORDS];
+    u32 last_used;
+    bool valid;
+} PidSupportCacheEntry_t;
+
+typedef struct {
+    PidSupportCacheEntry_t entries[PID_SUPPORT_CACHE_SIZE];
+    u32 use_counter;
+} PidSupportCache_t;
+
 typedef struct {
     ErrorHandler_t* error_handler;
     PidValueCallback_t value_callback;
+    PidEnhancedCallback_t enhanced_callback;
+    PidVirtualCallback_t virtual_callback;
     void* callback_context;
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
 } PidManagerConfig_t;
 
 typedef struct {
-    u8 supported_pids[32];
-    PidEntry_t entries[64];
-    u8 entry_count;
+    u32 supported_map[PID_SUPPORTED_WORDS];
+    PidDiscovery_t discovery;
+    PidEntry_t entries[PID_MAX_ENTRIES];
+    volatile u8 entry_count;
+    volatile u32 epoch;
+    PidComponentValue_t component_values[PID_COMPONENT_TABLE_SIZE];
+    u8 component_value_count;
+    PidSubscription_t subscriptions[PID_MAX_SUBSCRIBERS];
+    const PidEnhancedDefinition_t* enhanced_defs[PID_MAX_ENHANCED];
+    PidEntry_t enhanced_entries[PID_MAX_ENHANCED];
+    u8 enhanced_count;
+    u8 enhanced_index[PID_ENHANCED_HASH_SIZE];
+    PidEntry_t virtual_entries[PID_VIRTUAL_COUNT];
+    const PidPack_t* definition_pack;
+    PidEnhancedDefinition_t pack_enhanced[PID_MAX_ENHANCED];
+    u8 pack_enhanced_count;
+    PidStats_t stats;
+    PidPollProfile_t poll_profile;
+    u16 keepalive_rate_ms;
+    PidSchedulePolicy_t schedule_policy;
+    PidClassState_t classes[PID_PRIORITY_MAX];
+    u32 system_virtual_time;
+    u32 schedule_generation;
+    u64 class_window_start_us;
+    u32 total_notified;
+    u32 total_suppressed;
     bool initialized;
     ErrorHandler_t* error_handler;
     PidValueCallback_t value_callback;
+    PidEnhancedCallback_t enhanced_callback;
+    PidVirtualCallback_t virtual_callback;
     void* callback_context;
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
 } PidManager_t;
 
 Result_t PidManager_Init(PidManager_t* pm, const PidManagerConfig_t* config);
 
+Result_t PidManager_SetDefinitionPack(PidManager_t* pm, const PidPack_t* pack);
+
 Result_t PidManager_SetSupported(PidManager_t* pm, const u8* supported_data, u8 start_pid);
 
+Result_t PidManager_ApplySupportedMap(PidManager_t* pm, const u32* supported_map);
+
 bool PidManager_IsSupported(const PidManager_t* pm, u8 pid);
 
+Result_t PidManager_StartDiscovery(PidManager_t* pm);
+
+Result_t PidManager_GetDiscoveryRequest(PidManager_t* pm, u8* ranges, u8 max_ranges, u8* range_count);
+
+Result_t PidManager_ProcessDiscoveryResponse(PidManager_t* pm, u8 range_pid, const u8* data, u8 data_len);
+
+Result_t PidManager_CompleteDiscoveryBatch(PidManager_t* pm);
+
+bool PidManager_IsDiscoveryComplete(const PidManager_t* pm);
+
+Result_t PidSupportCache_Init(PidSupportCache_t* cache);
+
+Result_t PidManager_SaveSupportCache(const PidManager_t* pm, PidSupportCache_t* cache, const char* vin);
+
+Result_t PidManager_LoadSupportCache(PidManager_t* pm, PidSupportCache_t* cache, const char* vin);
+
 Result_t PidManager_EnablePid(PidManager_t* pm, u8 pid, u16 rate_ms);
 
 Result_t PidManager_DisablePid(PidManager_t* pm, u8 pid);
 
 Result_t PidManager_SetRate(PidManager_t* pm, u8 pid, u16 rate_ms);
 
+Result_t PidManager_Subscribe(PidManager_t* pm,
+                             const u8* pid_mask,
+                             u16 rate_ms,
+                             PidValueCallback_t callback,
+                             void* context,
+                             u8* subscription_id);
+
+Result_t PidManager_Unsubscribe(PidManager_t* pm, u8 subscription_id);
+
+Result_t PidManager_SetSubscriptionRate(PidManager_t* pm, u8 subscription_id, u16 rate_ms);
+
+void PidManager_MaskSet(u8* pid_mask, u8 pid);
+
+bool PidManager_MaskTest(const u8* pid_mask, u8 pid);
+
+Result_t PidManager_SetNotifyPolicy(PidManager_t* pm, u8 pid, const PidNotifyPolicy_t* policy);
+
+Result_t PidManager_GetNotifyStats(const PidManager_t* pm, u8 pid, u32* notified, u32* suppressed);
+
+void PidManager_GetNotifyTotals(const PidManager_t* pm, u32* notified, u32* suppressed);
+
 Result_t PidManager_ProcessFrame(PidManager_t* pm, const Obd2Frame_t* frame);
 
+Result_t PidManager_ProcessEcuFrame(PidManager_t* pm, const Obd2Frame_t* frame, u16 ecu_header);
+
+Result_t PidManager_ProcessFrameTimed(PidManager_t* pm,
+                                      const Obd2Frame_t* frame,
+                                      u16 ecu_header,
+                                      const PidFrameTiming_t* timing);
+
+Result_t PidManager_OnRequestSent(PidManager_t* pm, const PidRequest_t* request);
+
+Result_t PidManager_OnNoData(PidManager_t* pm, const PidRequest_t* request);
+
+const PidStats_t* PidManager_GetStats(const PidManager_t* pm);
+
+u32 PidManager_GetRequestCount(const PidManager_t* pm, const PidRequest_t* request);
+
 Result_t PidManager_GetValue(const PidManager_t* pm, u8 pid, PidValue_t* value);
 
+Result_t PidManager_GetComponents(const PidManager_t* pm,
+                                  u8 pid,
+                                  PidComponentValue_t* components,
+                                  u8 max_components,
+                                  u8* component_count);
+
+Result_t PidManager_GetSnapshot(const PidManager_t* pm, PidSnapshot_t* snapshot);
+
 Result_t PidManager_GetNextPidToRead(const PidManager_t* pm, u8* pid);
 
+Result_t PidManager_GetNextRequest(const PidManager_t* pm, PidRequest_t* request);
+
+Result_t PidManager_SetSchedulePolicy(PidManager_t* pm, PidSchedulePolicy_t policy);
+
+PidSchedulePolicy_t PidManager_GetSchedulePolicy(const PidManager_t* pm);
+
+u32 PidManager_GetScheduleGeneration(const PidManager_t* pm);
+
+Result_t PidManager_GetScheduledRequests(const PidManager_t* pm,
+                                         PidScheduledRequest_t* requests,
+                                         u8 max_requests,
+                                         u8* request_count);
+
+Result_t PidManager_SetClassWeight(PidManager_t* pm, u8 priority, u16 weight);
+
+Result_t PidManager_GetClassStats(const PidManager_t* pm, u8 priority, PidClassStats_t* stats);
+
+Result_t PidManager_ResetClassStats(PidManager_t* pm);
+
+Result_t PidManager_SetPollProfile(PidManager_t* pm, PidPollProfile_t profile);
+
+PidPollProfile_t PidManager_GetPollProfile(const PidManager_t* pm);
+
+Result_t PidManager_SetKeepAlive(PidManager_t* pm, u8 pid, bool keepalive);
+
+Result_t PidManager_SetKeepAliveRate(PidManager_t* pm, u16 rate_ms);
+
+Result_t PidManager_RegisterEnhanced(PidManager_t* pm, const PidEnhancedDefinition_t* def);
+
+Result_t PidManager_RegisterPackEnhanced(PidManager_t* pm, u8 mode, u16 did, u16 ecu_header);
+
+const PidEnhancedDefinition_t* PidManager_FindEnhanced(const PidManager_t* pm, u8 mode, u16 did, u16 ecu_header);
+
+Result_t PidManager_EnableEnhanced(PidManager_t* pm, u8 mode, u16 did, u16 ecu_header, u16 rate_ms);
+
+Result_t PidManager_DisableEnhanced(PidManager_t* pm, u8 mode, u16 did, u16 ecu_header);
+
+Result_t PidManager_ProcessEnhancedResponse(PidManager_t* pm,
+                                            u8 mode,
+                                            u16 did,
+                                            u16 ecu_header,
+                                            const u8* data,
+                                            u8 data_len);
+
+Result_t PidManager_ProcessEnhancedResponseTimed(PidManager_t* pm,
+                                                 u8 mode,
+                                                 u16 did,
+                                                 u16 ecu_header,
+                                                 const u8* data,
+                                                 u8 data_len,
+                                                 const PidFrameTiming_t* timing);
+
+Result_t PidManager_GetEnhancedValue(const PidManager_t* pm, u8 mode, u16 did, u16 ecu_header, PidValue_t* value);
+
 const PidDefinition_t* PidManager_GetDefinition(u8 pid);
 
+Result_t PidManager_EnableVirtual(PidManager_t* pm, u8 virtual_id, u16 rate_ms);
+
+Result_t PidManager_DisableVirtual(PidManager_t* pm, u8 virtual_id);
+
+Result_t PidManager_GetVirtualValue(const PidManager_t* pm, u8 virtual_id, PidValue_t* value);
+
+const PidVirtualDefinition_t* PidManager_GetVirtualDefinition(u8 virtual_id);
+
+u32 PidManager_GetDefinitionCount(void);
+
+const PidDefinition_t* PidManager_GetDefinitionAt(u32 index);
+
 Result_t PidManager_ConvertRawToEng(u8 pid, const u8* raw_data, u8 data_len, PidValue_t* value);
 
+Result_t PidManager_ConvertRawToFixed(u8 pid, const u8* raw_data, u8 data_len, PidFixedValue_t* value);
+
+float PidManager_FixedToFloat(const PidFixedValue_t* value);
+
+Result_t PidManager_DecodeComponents(u8 pid,
+                                     const u8* raw_data,
+                                     u8 data_len,
+                                     PidComponentValue_t* components,
+                                     u8 max_components,
+                                     u8* component_count);
+
+Result_t PidManager_ConvertColumn(u8 pid,
+                                  const u8* raw_bytes,
+                                  u8 stride,
+                                  const u32* timestamps_ms,
+                                  u32 count,
+                                  const PidBatchOutput_t* output);
+
+Result_t PidManager_ConvertBatch(const u8* pids,
+                                 const u8* raw_bytes,
+                                 const u32* timestamps_ms,
+                                 u32 count,
+                                 const PidBatchOutput_t* output);
+
 const char* PidManager_GetUnitString(PidUnit_t unit);
 
 u8 PidManager_GetSupportedCount(const PidManager_t* pm);
@@ -0,0 +1,601 @@
+#include "pid_history.h"
+#include <math.h>
+
+static const char* const resolution_strings[] = {
+    [PID_HISTORY_RES_RAW] = "Raw",
+    [PID_HISTORY_RES_TIER_1] = "Tier 1",
+    [PID_HISTORY_RES_TIER_2] = "Tier 2",
+    [PID_HISTORY_RES_TIER_3] = "Tier 3"
+};
+
+static const char* const interp_strings[] = {
+    [PID_HISTORY_INTERP_HOLD] = "Hold",
+    [PID_HISTORY_INTERP_LINEAR] = "Linear",
+    [PID_HISTORY_INTERP_PREDICT] = "Predict"
+};
+
+static const u32 default_tier_periods[PID_HISTORY_TIER_COUNT] = {
+    PID_HISTORY_TIER_1S_MS,
+    PID_HISTORY_TIER_10S_MS,
+    PID_HISTORY_TIER_1MIN_MS
+};
+
+static bool time_before(u32 a, u32 b)
+{
+    return ((i32)(a - b) < 0);
+}
+
+static void reset_channel(PidHistoryChannel_t* ch)
+{
+    ch->sample_head = 0U;
+    ch->sample_count = 0U;
+    
+    for (u8 t = 0U; t < PID_HISTORY_TIER_COUNT; t++) {
+        ch->tiers[t].head = 0U;
+        ch->tiers[t].count = 0U;
+    }
+    
+    ch->estimator.value = 0.0f;
+    ch->estimator.rate_per_ms = 0.0f;
+    ch->estimator.residual_variance = 0.0f;
+    ch->estimator.interval_ms = 0.0f;
+    ch->estimator.timestamp_ms = 0U;
+    ch->estimator.primed = false;
+}
+
+static PidHistoryChannel_t* find_channel(const PidHistory_t* ph, u8 pid)
+{
+    for (u8 i = 0U; i < ph->channel_count; i++) {
+        if ((ph->channels[i].in_use == true) && (ph->channels[i].pid == pid)) {
+            return &ph->channels[i];
+        }
+    }
+    return NULL_PTR;
+}
+
+static PidHistoryChannel_t* find_or_create_channel(PidHistory_t* ph, u8 pid)
+{
+    PidHistoryChannel_t* ch = find_channel(ph, pid);
+    
+    if (ch != NULL_PTR) {
+        return ch;
+    }
+    
+    for (u8 i = 0U; i < ph->channel_count; i++) {
+        if (ph->channels[i].in_use == false) {
+            ch = &ph->channels[i];
+            ch->pid = pid;
+            ch->in_use = true;
+            reset_channel(ch);
+            return ch;
+        }
+    }
+    
+    return NULL_PTR;
+}
+
+static u16 oldest_sample_index(const PidHistoryChannel_t* ch)
+{
+    return (u16)((ch->sample_head + PID_HISTORY_RAW_DEPTH - ch->sample_count) % PID_HISTORY_RAW_DEPTH);
+}
+
+static u8 oldest_bucket_index(const PidHistoryTier_t* tier)
+{
+    return (u8)((tier->head + PID_HISTORY_TIER_DEPTH + 1U - tier->count) % PID_HISTORY_TIER_DEPTH);
+}
+
+static void add_to_tier(PidHistoryTier_t* tier, u32 period_ms, u32 timestamp_ms, float value)
+{
+    u32 bucket_start = timestamp_ms - (timestamp_ms % period_ms);
+    PidHistoryBucket_t* bucket = &tier->buckets[tier->head];
+    
+    if ((tier->count > 0U) && (bucket->start_ms == bucket_start)) {
+        if (value < bucket->min_value) {
+            bucket->min_value = value;
+        }
+        if (value > bucket->max_value) {
+            bucket->max_value = value;
+        }
+        bucket->sum += value;
+        bucket->count++;
+        return;
+    }
+    
+    if ((tier->count > 0U) && (time_before(bucket_start, bucket->start_ms) == true)) {
+        return;
+    }
+    
+    if (tier->count > 0U) {
+        tier->head = (u8)((tier->head + 1U) % PID_HISTORY_TIER_DEPTH);
+    }
+    
+    if (tier->count < PID_HISTORY_TIER_DEPTH) {
+        tier->count++;
+    }
+    
+    bucket = &tier->buckets[tier->head];
+    bucket->start_ms = bucket_start;
+    bucket->min_value = value;
+    bucket->max_value = value;
+    bucket->sum = value;
+    bucket->count = 1U;
+}
+
+static void update_estimator(PidHistoryEstimator_t* est, float alpha, float beta, u32 timestamp_ms, float value)
+{
+    if (est->primed == false) {
+        est->value = value;
+        est->rate_per_ms = 0.0f;
+        est->residual_variance = 0.0f;
+        est->interval_ms = 0.0f;
+        est->timestamp_ms = timestamp_ms;
+        est->primed = true;
+        return;
+    }
+    
+    u32 dt = timestamp_ms - est->timestamp_ms;
+    
+    if ((dt == 0U) || (time_before(timestamp_ms, est->timestamp_ms) == true)) {
+        return;
+    }
+    
+    float predicted = est->value + (est->rate_per_ms * (float)dt);
+    float residual = value - predicted;
+    
+    est->value = predicted + (alpha * residual);
+    est->rate_per_ms += (beta * residual) / (float)dt;
+    est->residual_variance += PID_HISTORY_VARIANCE_GAIN * ((residual * residual) - est->residual_variance);
+    
+    if (est->interval_ms == 0.0f) {
+        est->interval_ms = (float)dt;
+    } else {
+        est->interval_ms += PID_HISTORY_VARIANCE_GAIN * ((float)dt - est->interval_ms);
+    }
+    
+    est->timestamp_ms = timestamp_ms;
+}
+
+static void predict_estimate(const PidHistoryEstimator_t* est, u32 timestamp_ms, PidHistoryEstimate_t* estimate)
+{
+    float horizon = (float)(i32)(timestamp_ms - est->timestamp_ms);
+    float steps = (est->interval_ms > 0.0f) ? (horizon / est->interval_ms) : 0.0f;
+    
+    estimate->value = est->value + (est->rate_per_ms * horizon);
+    estimate->uncertainty = sqrtf(est->residual_variance * (1.0f + (steps * steps)));
+    estimate->rate_per_s = est->rate_per_ms * 1000.0f;
+    estimate->method = PID_HISTORY_INTERP_PREDICT;
+    estimate->extrapolated = (horizon > 0.0f);
+}
+
+static bool raw_covers(const PidHistoryChannel_t* ch, u32 start_ms)
+{
+    if (ch->sample_count == 0U) {
+        return false;
+    }
+    
+    const PidHistorySample_t* oldest = &ch->samples[oldest_sample_index(ch)];
+    
+    return (time_before(start_ms, oldest->timestamp_ms) == false);
+}
+
+static bool tier_covers(const PidHistoryTier_t* tier, u32 start_ms)
+{
+    if (tier->count == 0U) {
+        return false;
+    }
+    
+    const PidHistoryBucket_t* oldest = &tier->buckets[oldest_bucket_index(tier)];
+    
+    return (time_before(start_ms, oldest->start_ms) == false);
+}
+
+static PidHistoryResolution_t select_resolution(const PidHistoryChannel_t* ch, u32 start_ms)
+{
+    if (raw_covers(ch, start_ms) == true) {
+        return PID_HISTORY_RES_RAW;
+    }
+    
+    for (u8 t = 0U; t < PID_HISTORY_TIER_COUNT; t++) {
+        if (tier_covers(&ch->tiers[t], start_ms) == true) {
+            return (PidHistoryResolution_t)(PID_HISTORY_RES_TIER_1 + t);
+        }
+    }
+    
+    for (u8 t = PID_HISTORY_TIER_COUNT; t > 0U; t--) {
+        if (ch->tiers[t - 1U].count > 0U) {
+            return (PidHistoryResolution_t)(PID_HISTORY_RES_TIER_1 + t - 1U);
+        }
+    }
+    
+    return PID_HISTORY_RES_RAW;
+}
+
+Result_t PidHistory_Init(PidHistory_t* ph, const PidHistoryConfig_t* config)
+{
+    if (ph == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (config == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if ((config->channels == NULL_PTR) || (config->channel_count == 0U)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    ph->channels = config->channels;
+    ph->channel_count = config->channel_count;
+    
+    for (u8 t = 0U; t < PID_HISTORY_TIER_COUNT; t++) {
+        if (config->tier_period_ms[t] == 0U) {
+            ph->tier_period_ms[t] = default_tier_periods[t];
+        } else {
+            ph->tier_period_ms[t] = config->tier_period_ms[t];
+        }
+    }
+    
+    for (u8 i = 0U; i < ph->channel_count; i++) {
+        ph->channels[i].in_use = false;
+        reset_channel(&ph->channels[i]);
+    }
+    
+    ph->alpha = (config->alpha > 0.0f) ? config->alpha : PID_HISTORY_DEFAULT_ALPHA;
+    ph->beta = (config->beta > 0.0f) ? config->beta : PID_HISTORY_DEFAULT_BETA;
+    ph->max_extrapolation_ms = (config->max_extrapolation_ms > 0U) ?
+                               config->max_extrapolation_ms : PID_HISTORY_DEFAULT_MAX_EXTRAPOLATION_MS;
+    ph->total_samples = 0U;
+    ph->dropped_samples = 0U;
+    ph->out_of_order_samples = 0U;
+    ph->error_handler = config->error_handler;
+    ph->initialized = true;
+    
+    return RESULT_OK;
+}
+
+Result_t PidHistory_AddSample(PidHistory_t* ph, u8 pid, const PidValue_t* value)
+{
+    if (ph == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (value == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (ph->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (value->valid == false) {
+        return RESULT_OK;
+    }
+    
+    PidHistoryChannel_t* ch = find_or_create_channel(ph, pid);
+    
+    if (ch == NULL_PTR) {
+        ph->dropped_samples++;
+        return RESULT_BUFFER_FULL;
+    }
+    
+    if (ch->sample_count > 0U) {
+        u16 last = (u16)((ch->sample_head + PID_HISTORY_RAW_DEPTH - 1U) % PID_HISTORY_RAW_DEPTH);
+        
+        if ((i32)(value->timestamp_ms - ch->samples[last].timestamp_ms) < 0) {
+            ph->out_of_order_samples++;
+            return RESULT_INVALID_PARAM;
+        }
+    }
+    
+    PidHistorySample_t* sample = &ch->samples[ch->sample_head];
+    sample->timestamp_ms = value->timestamp_ms;
+    sample->value = value->eng_value;
+    
+    ch->sample_head = (u16)((ch->sample_head + 1U) % PID_HISTORY_RAW_DEPTH);
+    
+    if (ch->sample_count < PID_HISTORY_RAW_DEPTH) {
+        ch->sample_count++;
+    }
+    
+    for (u8 t = 0U; t < PID_HISTORY_TIER_COUNT; t++) {
+        add_to_tier(&ch->tiers[t], ph->tier_period_ms[t], value->timestamp_ms, value->eng_value);
+    }
+    
+    update_estimator(&ch->estimator, ph->alpha, ph->beta, value->timestamp_ms, value->eng_value);
+    
+    ph->total_samples++;
+    
+    return RESULT_OK;
+}
+
+Result_t PidHistory_Query(const PidHistory_t* ph,
+                          u8 pid,
+                          u32 start_ms,
+                          u32 end_ms,
+                          PidHistoryPoint_t* points,
+                          u16 max_points,
+                          u16* point_count,
+                          PidHistoryResolution_t* resolution)
+{
+    if (ph == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if ((points == NULL_PTR) || (point_count == NULL_PTR)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (ph->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    *point_count = 0U;
+    
+    const PidHistoryChannel_t* ch = find_channel(ph, pid);
+    
+    if ((ch == NULL_PTR) || (ch->sample_count == 0U)) {
+        return RESULT_NO_DATA;
+    }
+    
+    PidHistoryResolution_t res = select_resolution(ch, start_ms);
+    u16 count = 0U;
+    
+    if (res == PID_HISTORY_RES_RAW) {
+        u16 idx = oldest_sample_index(ch);
+        
+        for (u16 i = 0U; (i < ch->sample_count) && (count < max_points); i++) {
+            const PidHistorySample_t* sample = &ch->samples[idx];
+            
+            if ((time_before(sample->timestamp_ms, start_ms) == false) &&
+                (time_before(end_ms, sample->timestamp_ms) == false)) {
+                points[count].timestamp_ms = sample->timestamp_ms;
+                points[count].min_value = sample->value;
+                points[count].max_value = sample->value;
+                points[count].mean_value = sample->value;
+                points[count].count = 1U;
+                count++;
+            }
+            
+            idx = (u16)((idx + 1U) % PID_HISTORY_RAW_DEPTH);
+        }
+    } else {
+        u8 tier_idx = (u8)(res - PID_HISTORY_RES_TIER_1);
+        const PidHistoryTier_t* tier = &ch->tiers[tier_idx];
+        u32 period = ph->tier_period_ms[tier_idx];
+        u8 idx = oldest_bucket_index(tier);
+        
+        for (u8 i = 0U; (i < tier->count) && (count < max_points); i++) {
+            const PidHistoryBucket_t* bucket = &tier->buckets[idx];
+            
+            if ((time_before(bucket->start_ms + period - 1U, start_ms) == false) &&
+                (time_before(end_ms, bucket->start_ms) == false)) {
+                points[count].timestamp_ms = bucket->start_ms;
+                points[count].min_value = bucket->min_value;
+                points[count].max_value = bucket->max_value;
+                points[count].mean_value = bucket->sum / (float)bucket->count;
+                points[count].count = bucket->count;
+                count++;
+            }
+            
+            idx = (u8)((idx + 1U) % PID_HISTORY_TIER_DEPTH);
+        }
+    }
+    
+    *point_count = count;
+    
+    if (resolution != NULL_PTR) {
+        *resolution = res;
+    }
+    
+    return (count > 0U) ? RESULT_OK : RESULT_NO_DATA;
+}
+
+Result_t PidHistory_ValueAt(const PidHistory_t* ph,
+                            u8 pid,
+                            u32 timestamp_ms,
+                            PidHistoryInterp_t mode,
+                            PidHistoryEstimate_t* estimate)
+{
+    if (ph == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if ((estimate == NULL_PTR) || (mode >= PID_HISTORY_INTERP_MAX)) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (ph->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    const PidHistoryChannel_t* ch = find_channel(ph, pid);
+    
+    if ((ch == NULL_PTR) || (ch->sample_count == 0U)) {
+        return RESULT_NO_DATA;
+    }
+    
+    const PidHistoryEstimator_t* est = &ch->estimator;
+    u16 oldest = oldest_sample_index(ch);
+    u16 newest = (u16)((ch->sample_head + PID_HISTORY_RAW_DEPTH - 1U) % PID_HISTORY_RAW_DEPTH);
+    
+    if (time_before(timestamp_ms, ch->samples[oldest].timestamp_ms) == true) {
+        return RESULT_NO_DATA;
+    }
+    
+    if (time_before(ch->samples[newest].timestamp_ms, timestamp_ms) == true) {
+        if ((timestamp_ms - est->timestamp_ms) > ph->max_extrapolation_ms) {
+            return RESULT_NO_DATA;
+        }
+        
+        if (mode != PID_HISTORY_INTERP_HOLD) {
+            predict_estimate(est, timestamp_ms, estimate);
+            return RESULT_OK;
+        }
+    }
+    
+    u16 lo = 0U;
+    u16 hi = (u16)(ch->sample_count - 1U);
+    
+    while (lo < hi) {
+        u16 mid = (u16)((lo + hi + 1U) / 2U);
+        const PidHistorySample_t* sample = &ch->samples[(oldest + mid) % PID_HISTORY_RAW_DEPTH];
+        
+        if (time_before(timestamp_ms, sample->timestamp_ms) == true) {
+            hi = (u16)(mid - 1U);
+        } else {
+            lo = mid;
+        }
+    }
+    
+    const PidHistorySample_t* before = &ch->samples[(oldest + lo) % PID_HISTORY_RAW_DEPTH];
+    
+    if (mode == PID_HISTORY_INTERP_PREDICT) {
+        mode = PID_HISTORY_INTERP_LINEAR;
+    }
+    
+    estimate->value = before->value;
+    estimate->uncertainty = sqrtf(est->residual_variance);
+    estimate->rate_per_s = est->rate_per_ms * 1000.0f;
+    estimate->method = mode;
+    estimate->extrapolated = false;
+    
+    if ((u16)(lo + 1U) >= ch->sample_count) {
+        estimate->extrapolated = (timestamp_ms != before->timestamp_ms);
+        estimate->method = PID_HISTORY_INTERP_HOLD;
+        return RESULT_OK;
+    }
+    
+    const PidHistorySample_t* after = &ch->samples[(oldest + lo + 1U) % PID_HISTORY_RAW_DEPTH];
+    u32 span = after->timestamp_ms - before->timestamp_ms;
+    
+    if (span > 0U) {
+        float slope = (after->value - before->value) / (float)span;
+        estimate->rate_per_s = slope * 1000.0f;
+        
+        if (mode == PID_HISTORY_INTERP_LINEAR) {
+            estimate->value = before->value + (slope * (float)(timestamp_ms - before->timestamp_ms));
+        }
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t PidHistory_GetLatest(const PidHistory_t* ph, u8 pid, PidHistorySample_t* sample)
+{
+    if (ph == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (sample == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (ph->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    const PidHistoryChannel_t* ch = find_channel(ph, pid);
+    
+    if ((ch == NULL_PTR) || (ch->sample_count == 0U)) {
+        return RESULT_NO_DATA;
+    }
+    
+    u16 idx = (u16)((ch->sample_head + PID_HISTORY_RAW_DEPTH - 1U) % PID_HISTORY_RAW_DEPTH);
+    *sample = ch->samples[idx];
+    
+    return RESULT_OK;
+}
+
+Result_t PidHistory_Clear(PidHistory_t* ph, u8 pid)
+{
+    if (ph == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (ph->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    PidHistoryChannel_t* ch = find_channel(ph, pid);
+    
+    if (ch != NULL_PTR) {
+        reset_channel(ch);
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t PidHistory_ClearAll(PidHistory_t* ph)
+{
+    if (ph == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (ph->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    for (u8 i = 0U; i < ph->channel_count; i++) {
+        ph->channels[i].in_use = false;
+        reset_channel(&ph->channels[i]);
+    }
+    
+    return RESULT_OK;
+}
+
+u32 PidHistory_GetTotalSamples(const PidHistory_t* ph)
+{
+    if (ph == NULL_PTR) {
+        return 0U;
+    }
+    
+    if (ph->initialized == false) {
+        return 0U;
+    }
+    
+    return ph->total_samples;
+}
+
+u32 PidHistory_GetDroppedSamples(const PidHistory_t* ph)
+{
+    if (ph == NULL_PTR) {
+        return 0U;
+    }
+    
+    if (ph->initialized == false) {
+        return 0U;
+    }
+    
+    return ph->dropped_samples;
+}
+
+u32 PidHistory_GetOutOfOrderSamples(const PidHistory_t* ph)
+{
+    if (ph == NULL_PTR) {
+        return 0U;
+    }
+    
+    if (ph->initialized == false) {
+        return 0U;
+    }
+    
+    return ph->out_of_order_samples;
+}
+
+const char* PidHistory_GetResolutionString(PidHistoryResolution_t resolution)
+{
+    if (resolution >= PID_HISTORY_RES_MAX) {
+        return "Unknown";
+    }
+    
+    return resolution_strings[resolution];
+}
+
+const char* PidHistory_GetInterpString(PidHistoryInterp_t mode)
+{
+    if (mode >= PID_HISTORY_INTERP_MAX) {
+        return "Unknown";
+    }
+    
+    return interp_strings[mode];
+}
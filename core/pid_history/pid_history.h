@@ -0,0 +1,147 @@
+#ifndef PID_HISTORY_H
+#define PID_HISTORY_H
+
+#include "../types.h"
+#include "../pid/pid_manager.h"
+#include "../error/error_handler.h"
+
+#define PID_HISTORY_RAW_DEPTH 64
+#define PID_HISTORY_TIER_COUNT 3
+#define PID_HISTORY_TIER_DEPTH 60
+#define PID_HISTORY_TIER_1S_MS 1000
+#define PID_HISTORY_TIER_10S_MS 10000
+#define PID_HISTORY_TIER_1MIN_MS 60000
+#define PID_HISTORY_DEFAULT_ALPHA 0.5f
+#define PID_HISTORY_DEFAULT_BETA 0.1f
+#define PID_HISTORY_DEFAULT_MAX_EXTRAPOLATION_MS 1000
+#define PID_HISTORY_VARIANCE_GAIN 0.125f
+
+typedef enum {
+    PID_HISTORY_RES_RAW = 0,
+    PID_HISTORY_RES_TIER_1 = 1,
+    PID_HISTORY_RES_TIER_2 = 2,
+    PID_HISTORY_RES_TIER_3 = 3,
+    PID_HISTORY_RES_MAX
+} PidHistoryResolution_t;
+
+typedef enum {
+    PID_HISTORY_INTERP_HOLD = 0,
+    PID_HISTORY_INTERP_LINEAR = 1,
+    PID_HISTORY_INTERP_PREDICT = 2,
+    PID_HISTORY_INTERP_MAX
+} PidHistoryInterp_t;
+
+typedef struct {
+    u32 timestamp_ms;
+    float value;
+} PidHistorySample_t;
+
+typedef struct {
+    float value;
+    float rate_per_ms;
+    float residual_variance;
+    float interval_ms;
+    u32 timestamp_ms;
+    bool primed;
+} PidHistoryEstimator_t;
+
+typedef struct {
+    float value;
+    float uncertainty;
+    float rate_per_s;
+    PidHistoryInterp_t method;
+    bool extrapolated;
+} PidHistoryEstimate_t;
+
+typedef struct {
+    u32 start_ms;
+    float min_value;
+    float max_value;
+    float sum;
+    u16 count;
+} PidHistoryBucket_t;
+
+typedef struct {
+    PidHistoryBucket_t buckets[PID_HISTORY_TIER_DEPTH];
+    u8 head;
+    u8 count;
+} PidHistoryTier_t;
+
+typedef struct {
+    u8 pid;
+    bool in_use;
+    PidHistorySample_t samples[PID_HISTORY_RAW_DEPTH];
+    u16 sample_head;
+    u16 sample_count;
+    PidHistoryTier_t tiers[PID_HISTORY_TIER_COUNT];
+    PidHistoryEstimator_t estimator;
+} PidHistoryChannel_t;
+
+typedef struct {
+    u32 timestamp_ms;
+    float min_value;
+    float max_value;
+    float mean_value;
+    u16 count;
+} PidHistoryPoint_t;
+
+typedef struct {
+    ErrorHandler_t* error_handler;
+    PidHistoryChannel_t* channels;
+    u8 channel_count;
+    u32 tier_period_ms[PID_HISTORY_TIER_COUNT];
+    float alpha;
+    float beta;
+    u32 max_extrapolation_ms;
+} PidHistoryConfig_t;
+
+typedef struct {
+    PidHistoryChannel_t* channels;
+    u8 channel_count;
+    u32 tier_period_ms[PID_HISTORY_TIER_COUNT];
+    float alpha;
+    float beta;
+    u32 max_extrapolation_ms;
+    bool initialized;
+    ErrorHandler_t* error_handler;
+    u32 total_samples;
+    u32 dropped_samples;
+    u32 out_of_order_samples;
+} PidHistory_t;
+
+Result_t PidHistory_Init(PidHistory_t* ph, const PidHistoryConfig_t* config);
+
+Result_t PidHistory_AddSample(PidHistory_t* ph, u8 pid, const PidValue_t* value);
+
+Result_t PidHistory_Query(const PidHistory_t* ph,
+                          u8 pid,
+                          u32 start_ms,
+                          u32 end_ms,
+                          PidHistoryPoint_t* points,
+                          u16 max_points,
+                          u16* point_count,
+                          PidHistoryResolution_t* resolution);
+
+Result_t PidHistory_ValueAt(const PidHistory_t* ph,
+                            u8 pid,
+                            u32 timestamp_ms,
+                            PidHistoryInterp_t mode,
+                            PidHistoryEstimate_t* estimate);
+
+Result_t PidHistory_GetLatest(const PidHistory_t* ph, u8 pid, PidHistorySample_t* sample);
+
+Result_t PidHistory_Clear(PidHistory_t* ph, u8 pid);
+
+Result_t PidHistory_ClearAll(PidHistory_t* ph);
+
+u32 PidHistory_GetTotalSamples(const PidHistory_t* ph);
+
+u32 PidHistory_GetDroppedSamples(const PidHistory_t* ph);
+
+u32 PidHistory_GetOutOfOrderSamples(const PidHistory_t* ph);
+
+const char* PidHistory_GetResolutionString(PidHistoryResolution_t resolution);
+
+const char* PidHistory_GetInterpString(PidHistoryInterp_t mode);
+
+#endif
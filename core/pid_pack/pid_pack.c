@@ -0,0 +1,257 @@
+#include "pid_pack.h"
+#include <string.h>
+
+static const char* const status_strings[] = {
+    [PID_PACK_OK] = "OK",
+    [PID_PACK_ERR_SIZE] = "Size mismatch",
+    [PID_PACK_ERR_MAGIC] = "Bad magic",
+    [PID_PACK_ERR_VERSION] = "Unsupported version",
+    [PID_PACK_ERR_LAYOUT] = "Bad layout",
+    [PID_PACK_ERR_STRINGS] = "Bad string table"
+};
+
+static u16 read_u16(const u8* data)
+{
+    return (u16)((u16)data[0] | ((u16)data[1] << 8U));
+}
+
+static u32 read_u32(const u8* data)
+{
+    return (u32)data[0] |
+           ((u32)data[1] << 8U) |
+           ((u32)data[2] << 16U) |
+           ((u32)data[3] << 24U);
+}
+
+static float read_float(const u8* data)
+{
+    u32 bits = read_u32(data);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static bool region_fits(u32 offset, u32 length, u32 size)
+{
+    return (offset <= size) && (length <= (size - offset));
+}
+
+static PidPackStatus_t validate_header(const u8* data, u32 size)
+{
+    if (size < PID_PACK_HEADER_SIZE) {
+        return PID_PACK_ERR_SIZE;
+    }
+    
+    if (read_u32(&data[0]) != PID_PACK_MAGIC) {
+        return PID_PACK_ERR_MAGIC;
+    }
+    
+    if ((read_u16(&data[4]) != PID_PACK_VERSION) || (read_u16(&data[6]) != PID_PACK_HEADER_SIZE)) {
+        return PID_PACK_ERR_VERSION;
+    }
+    
+    if (read_u32(&data[28]) != size) {
+        return PID_PACK_ERR_SIZE;
+    }
+    
+    u16 record_count = read_u16(&data[8]);
+    u16 bucket_count = read_u16(&data[10]);
+    
+    if ((record_count == 0U) || (bucket_count == 0U)) {
+        return PID_PACK_ERR_LAYOUT;
+    }
+    
+    if (region_fits(read_u32(&data[12]), (u32)bucket_count * 2U, size) == false) {
+        return PID_PACK_ERR_LAYOUT;
+    }
+    
+    if (region_fits(read_u32(&data[16]), (u32)record_count * PID_PACK_RECORD_SIZE, size) == false) {
+        return PID_PACK_ERR_LAYOUT;
+    }
+    
+    u32 string_offset = read_u32(&data[20]);
+    u32 string_size = read_u32(&data[24]);
+    
+    if ((string_size == 0U) || (region_fits(string_offset, string_size, size) == false)) {
+        return PID_PACK_ERR_STRINGS;
+    }
+    
+    if (data[string_offset + string_size - 1U] != 0U) {
+        return PID_PACK_ERR_STRINGS;
+    }
+    
+    return PID_PACK_OK;
+}
+
+static bool decode_record(const PidPack_t* pack, u16 index, PidPackDefinition_t* def)
+{
+    const u8* record = &pack->records[(u32)index * PID_PACK_RECORD_SIZE];
+    u32 key = read_u32(&record[0]);
+    u16 name_offset = read_u16(&record[4]);
+    u16 short_name_offset = read_u16(&record[6]);
+    
+    if ((name_offset >= pack->string_size) || (short_name_offset >= pack->string_size)) {
+        return false;
+    }
+    
+    def->mode = (u8)(key >> 16U);
+    def->did = (u16)(key & 0xFFFFU);
+    def->name = &pack->strings[name_offset];
+    def->short_name = &pack->strings[short_name_offset];
+    def->unit = record[8];
+    def->data_type = record[9];
+    def->data_bytes = record[10];
+    def->priority = record[11];
+    def->scale_num = read_u16(&record[12]);
+    def->scale_den = read_u16(&record[14]);
+    def->offset = (i32)read_u32(&record[16]);
+    def->min_value = read_float(&record[20]);
+    def->max_value = read_float(&record[24]);
+    def->default_rate_ms = read_u16(&record[28]);
+    
+    return (def->scale_den != 0U);
+}
+
+u32 PidPack_Hash(u32 key, u32 seed)
+{
+    u32 h = key ^ (seed * 0x9E3779B9U);
+    h ^= h >> 16U;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13U;
+    h *= 0xC2B2AE35U;
+    h ^= h >> 16U;
+    return h;
+}
+
+Result_t PidPack_Load(PidPack_t* pack, const u8* data, u32 size)
+{
+    if (pack == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    pack->loaded = false;
+    
+    if (data == NULL_PTR) {
+        pack->status = PID_PACK_ERR_SIZE;
+        return RESULT_INVALID_PARAM;
+    }
+    
+    pack->status = validate_header(data, size);
+    
+    if (pack->status != PID_PACK_OK) {
+        return RESULT_ERROR;
+    }
+    
+    pack->data = data;
+    pack->size = size;
+    pack->record_count = read_u16(&data[8]);
+    pack->bucket_count = read_u16(&data[10]);
+    pack->displacements = &data[read_u32(&data[12])];
+    pack->records = &data[read_u32(&data[16])];
+    pack->strings = (const char*)&data[read_u32(&data[20])];
+    pack->string_size = read_u32(&data[24]);
+    pack->loaded = true;
+    
+    return RESULT_OK;
+}
+
+Result_t PidPack_Unload(PidPack_t* pack)
+{
+    if (pack == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    pack->data = NULL_PTR;
+    pack->size = 0U;
+    pack->record_count = 0U;
+    pack->bucket_count = 0U;
+    pack->loaded = false;
+    
+    return RESULT_OK;
+}
+
+Result_t PidPack_Find(const PidPack_t* pack, u8 mode, u16 did, PidPackDefinition_t* def)
+{
+    if (pack == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (def == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pack->loaded == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    u32 key = PID_PACK_KEY(mode, did);
+    u16 bucket = (u16)(PidPack_Hash(key, 0U) % pack->bucket_count);
+    u16 displacement = read_u16(&pack->displacements[(u32)bucket * 2U]);
+    u16 slot = (u16)(PidPack_Hash(key, (u32)displacement + 1U) % pack->record_count);
+    
+    if (read_u32(&pack->records[(u32)slot * PID_PACK_RECORD_SIZE]) != key) {
+        return RESULT_NO_DATA;
+    }
+    
+    if (decode_record(pack, slot, def) == false) {
+        return RESULT_ERROR;
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t PidPack_GetAt(const PidPack_t* pack, u16 index, PidPackDefinition_t* def)
+{
+    if (pack == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (def == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (pack->loaded == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (index >= pack->record_count) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (decode_record(pack, index, def) == false) {
+        return RESULT_ERROR;
+    }
+    
+    return RESULT_OK;
+}
+
+u16 PidPack_GetCount(const PidPack_t* pack)
+{
+    if (pack == NULL_PTR) {
+        return 0U;
+    }
+    
+    if (pack->loaded == false) {
+        return 0U;
+    }
+    
+    return pack->record_count;
+}
+
+PidPackStatus_t PidPack_GetStatus(const PidPack_t* pack)
+{
+    if (pack == NULL_PTR) {
+        return PID_PACK_ERR_SIZE;
+    }
+    
+    return pack->status;
+}
+
+const char* PidPack_GetStatusString(PidPackStatus_t status)
+{
+    if (status >= PID_PACK_ERR_MAX) {
+        return "Unknown";
+    }
+    
+    return status_strings[status];
+}
@@ -0,0 +1,70 @@
+#ifndef PID_PACK_H
+#define PID_PACK_H
+
+#include "../types.h"
+
+#define PID_PACK_MAGIC 0x50444950UL
+#define PID_PACK_VERSION 1
+#define PID_PACK_HEADER_SIZE 36
+#define PID_PACK_RECORD_SIZE 32
+#define PID_PACK_MAX_DISPLACEMENT 0xFFFF
+
+#define PID_PACK_KEY(mode, did) (((u32)(mode) << 16U) | (u32)(did))
+
+typedef enum {
+    PID_PACK_OK = 0,
+    PID_PACK_ERR_SIZE = 1,
+    PID_PACK_ERR_MAGIC = 2,
+    PID_PACK_ERR_VERSION = 3,
+    PID_PACK_ERR_LAYOUT = 4,
+    PID_PACK_ERR_STRINGS = 5,
+    PID_PACK_ERR_MAX
+} PidPackStatus_t;
+
+typedef struct {
+    u8 mode;
+    u16 did;
+    const char* name;
+    const char* short_name;
+    u8 unit;
+    u8 data_type;
+    u8 data_bytes;
+    u8 priority;
+    u16 scale_num;
+    u16 scale_den;
+    i32 offset;
+    float min_value;
+    float max_value;
+    u16 default_rate_ms;
+} PidPackDefinition_t;
+
+typedef struct {
+    const u8* data;
+    u32 size;
+    u16 record_count;
+    u16 bucket_count;
+    const u8* displacements;
+    const u8* records;
+    const char* strings;
+    u32 string_size;
+    PidPackStatus_t status;
+    bool loaded;
+} PidPack_t;
+
+u32 PidPack_Hash(u32 key, u32 seed);
+
+Result_t PidPack_Load(PidPack_t* pack, const u8* data, u32 size);
+
+Result_t PidPack_Unload(PidPack_t* pack);
+
+Result_t PidPack_Find(const PidPack_t* pack, u8 mode, u16 did, PidPackDefinition_t* def);
+
+Result_t PidPack_GetAt(const PidPack_t* pack, u16 index, PidPackDefinition_t* def);
+
+u16 PidPack_GetCount(const PidPack_t* pack);
+
+PidPackStatus_t PidPack_GetStatus(const PidPack_t* pack);
+
+const char* PidPack_GetStatusString(PidPackStatus_t status);
+
+#endif
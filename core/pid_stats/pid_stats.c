@@ -0,0 +1,306 @@
+#include "pid_stats.h"
+
+static u8 highest_bit(u32 value)
+{
+    u8 bit = 0U;
+    
+    while (value > 1U) {
+        value >>= 1U;
+        bit++;
+    }
+    
+    return bit;
+}
+
+static PidStatsRecord_t* find_record(PidStats_t* stats, u8 mode, u16 id, u16 ecu_header)
+{
+    for (u8 i = 0U; i < stats->record_count; i++) {
+        PidStatsRecord_t* record = &stats->records[i];
+        
+        if ((record->mode == mode) && (record->id == id) && (record->ecu_header == ecu_header)) {
+            return record;
+        }
+    }
+    return NULL_PTR;
+}
+
+static PidStatsRecord_t* find_or_create_record(PidStats_t* stats, u8 mode, u16 id, u16 ecu_header)
+{
+    PidStatsRecord_t* record = find_record(stats, mode, id, ecu_header);
+    
+    if (record != NULL_PTR) {
+        return record;
+    }
+    
+    if (stats->record_count >= PID_STATS_MAX_RECORDS) {
+        stats->dropped_records++;
+        return NULL_PTR;
+    }
+    
+    record = &stats->records[stats->record_count];
+    record->mode = mode;
+    record->id = id;
+    record->ecu_header = ecu_header;
+    record->responses = 0U;
+    record->no_data_count = 0U;
+    record->decode_failures = 0U;
+    record->configured_rate_ms = 0U;
+    record->last_response_ms = 0U;
+    record->interval_sum_ms = 0U;
+    record->interval_count = 0U;
+    PidStats_HistogramInit(&record->latency_ms);
+    PidStats_HistogramInit(&record->response_bytes);
+    stats->record_count++;
+    
+    return record;
+}
+
+Result_t PidStats_Init(PidStats_t* stats)
+{
+    if (stats == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    stats->record_count = 0U;
+    stats->dropped_records = 0U;
+    
+    return RESULT_OK;
+}
+
+Result_t PidStats_Reset(PidStats_t* stats)
+{
+    return PidStats_Init(stats);
+}
+
+Result_t PidStats_RecordResponse(PidStats_t* stats,
+                                 u8 mode,
+                                 u16 id,
+                                 u16 ecu_header,
+                                 u32 latency_ms,
+                                 u8 response_bytes,
+                                 u32 timestamp_ms,
+                                 u16 configured_rate_ms)
+{
+    if (stats == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    PidStatsRecord_t* record = find_or_create_record(stats, mode, id, ecu_header);
+    
+    if (record == NULL_PTR) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    if (record->responses > 0U) {
+        record->interval_sum_ms += timestamp_ms - record->last_response_ms;
+        record->interval_count++;
+    }
+    
+    record->responses++;
+    record->last_response_ms = timestamp_ms;
+    record->configured_rate_ms = configured_rate_ms;
+    
+    if (latency_ms != PID_STATS_NO_LATENCY) {
+        PidStats_HistogramRecord(&record->latency_ms, latency_ms);
+    }
+    
+    PidStats_HistogramRecord(&record->response_bytes, response_bytes);
+    
+    return RESULT_OK;
+}
+
+Result_t PidStats_RecordNoData(PidStats_t* stats, u8 mode, u16 id, u16 ecu_header)
+{
+    if (stats == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    PidStatsRecord_t* record = find_or_create_record(stats, mode, id, ecu_header);
+    
+    if (record == NULL_PTR) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    record->no_data_count++;
+    
+    return RESULT_OK;
+}
+
+Result_t PidStats_RecordDecodeFailure(PidStats_t* stats, u8 mode, u16 id, u16 ecu_header)
+{
+    if (stats == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    PidStatsRecord_t* record = find_or_create_record(stats, mode, id, ecu_header);
+    
+    if (record == NULL_PTR) {
+        return RESULT_BUFFER_FULL;
+    }
+    
+    record->decode_failures++;
+    
+    return RESULT_OK;
+}
+
+const PidStatsRecord_t* PidStats_Find(const PidStats_t* stats, u8 mode, u16 id, u16 ecu_header)
+{
+    if (stats == NULL_PTR) {
+        return NULL_PTR;
+    }
+    
+    for (u8 i = 0U; i < stats->record_count; i++) {
+        const PidStatsRecord_t* record = &stats->records[i];
+        
+        if ((record->mode == mode) && (record->id == id) && (record->ecu_header == ecu_header)) {
+            return record;
+        }
+    }
+    return NULL_PTR;
+}
+
+const PidStatsRecord_t* PidStats_GetAt(const PidStats_t* stats, u8 index)
+{
+    if (stats == NULL_PTR) {
+        return NULL_PTR;
+    }
+    
+    if (index >= stats->record_count) {
+        return NULL_PTR;
+    }
+    
+    return &stats->records[index];
+}
+
+u8 PidStats_GetCount(const PidStats_t* stats)
+{
+    if (stats == NULL_PTR) {
+        return 0U;
+    }
+    
+    return stats->record_count;
+}
+
+u32 PidStats_GetAchievedIntervalMs(const PidStatsRecord_t* record)
+{
+    if (record == NULL_PTR) {
+        return 0U;
+    }
+    
+    if (record->interval_count == 0U) {
+        return 0U;
+    }
+    
+    return record->interval_sum_ms / record->interval_count;
+}
+
+void PidStats_HistogramInit(PidStatsHistogram_t* hist)
+{
+    if (hist == NULL_PTR) {
+        return;
+    }
+    
+    for (u8 i = 0U; i < PID_STATS_HIST_BUCKETS; i++) {
+        hist->counts[i] = 0U;
+    }
+    
+    hist->total = 0U;
+    hist->min_value = 0xFFFFFFFFU;
+    hist->max_value = 0U;
+    hist->sum = 0U;
+}
+
+void PidStats_HistogramRecord(PidStatsHistogram_t* hist, u32 value)
+{
+    if (hist == NULL_PTR) {
+        return;
+    }
+    
+    u8 index = PidStats_BucketIndex(value);
+    
+    if (hist->counts[index] == 0xFFFFU) {
+        for (u8 i = 0U; i < PID_STATS_HIST_BUCKETS; i++) {
+            hist->counts[i] = (u16)((hist->counts[i] + 1U) / 2U);
+        }
+    }
+    
+    hist->counts[index]++;
+    
+    hist->total++;
+    hist->sum += value;
+    
+    if (value < hist->min_value) {
+        hist->min_value = value;
+    }
+    
+    if (value > hist->max_value) {
+        hist->max_value = value;
+    }
+}
+
+u32 PidStats_HistogramPercentile(const PidStatsHistogram_t* hist, u16 permille)
+{
+    if (hist == NULL_PTR) {
+        return 0U;
+    }
+    
+    u32 recorded = 0U;
+    
+    for (u8 i = 0U; i < PID_STATS_HIST_BUCKETS; i++) {
+        recorded += hist->counts[i];
+    }
+    
+    if (recorded == 0U) {
+        return 0U;
+    }
+    
+    if (permille > 1000U) {
+        permille = 1000U;
+    }
+    
+    u32 target = ((recorded * permille) + 999U) / 1000U;
+    u32 cumulative = 0U;
+    
+    if (target == 0U) {
+        target = 1U;
+    }
+    
+    for (u8 i = 0U; i < PID_STATS_HIST_BUCKETS; i++) {
+        cumulative += hist->counts[i];
+        
+        if (cumulative >= target) {
+            return PidStats_BucketLowerBound(i);
+        }
+    }
+    
+    return hist->max_value;
+}
+
+u8 PidStats_BucketIndex(u32 value)
+{
+    if (value < PID_STATS_SUB_BUCKETS) {
+        return (u8)value;
+    }
+    
+    u8 msb = highest_bit(value);
+    u32 index = ((u32)(msb - PID_STATS_SUB_BITS + 1U) * PID_STATS_SUB_BUCKETS) +
+                ((value >> (msb - PID_STATS_SUB_BITS)) & (PID_STATS_SUB_BUCKETS - 1U));
+    
+    if (index >= PID_STATS_HIST_BUCKETS) {
+        index = PID_STATS_HIST_BUCKETS - 1U;
+    }
+    
+    return (u8)index;
+}
+
+u32 PidStats_BucketLowerBound(u8 index)
+{
+    if (index < PID_STATS_SUB_BUCKETS) {
+        return index;
+    }
+    
+    u32 msb = ((u32)index / PID_STATS_SUB_BUCKETS) + PID_STATS_SUB_BITS - 1U;
+    u32 sub = (u32)index % PID_STATS_SUB_BUCKETS;
+    
+    return (PID_STATS_SUB_BUCKETS + sub) << (msb - PID_STATS_SUB_BITS);
+}
@@ -0,0 +1,77 @@
+#ifndef PID_STATS_H
+#define PID_STATS_H
+
+#include "../types.h"
+
+#define PID_STATS_MAX_RECORDS 32
+#define PID_STATS_SUB_BITS 2
+#define PID_STATS_SUB_BUCKETS (1U << PID_STATS_SUB_BITS)
+#define PID_STATS_HIST_BUCKETS 48
+#define PID_STATS_ECU_ANY 0x0000
+#define PID_STATS_NO_LATENCY 0xFFFFFFFFUL
+
+typedef struct {
+    u16 counts[PID_STATS_HIST_BUCKETS];
+    u32 total;
+    u32 min_value;
+    u32 max_value;
+    u32 sum;
+} PidStatsHistogram_t;
+
+typedef struct {
+    u8 mode;
+    u16 id;
+    u16 ecu_header;
+    u32 responses;
+    u32 no_data_count;
+    u32 decode_failures;
+    u16 configured_rate_ms;
+    u32 last_response_ms;
+    u32 interval_sum_ms;
+    u32 interval_count;
+    PidStatsHistogram_t latency_ms;
+    PidStatsHistogram_t response_bytes;
+} PidStatsRecord_t;
+
+typedef struct {
+    PidStatsRecord_t records[PID_STATS_MAX_RECORDS];
+    u8 record_count;
+    u32 dropped_records;
+} PidStats_t;
+
+Result_t PidStats_Init(PidStats_t* stats);
+
+Result_t PidStats_Reset(PidStats_t* stats);
+
+Result_t PidStats_RecordResponse(PidStats_t* stats,
+                                 u8 mode,
+                                 u16 id,
+                                 u16 ecu_header,
+                                 u32 latency_ms,
+                                 u8 response_bytes,
+                                 u32 timestamp_ms,
+                                 u16 configured_rate_ms);
+
+Result_t PidStats_RecordNoData(PidStats_t* stats, u8 mode, u16 id, u16 ecu_header);
+
+Result_t PidStats_RecordDecodeFailure(PidStats_t* stats, u8 mode, u16 id, u16 ecu_header);
+
+const PidStatsRecord_t* PidStats_Find(const PidStats_t* stats, u8 mode, u16 id, u16 ecu_header);
+
+const PidStatsRecord_t* PidStats_GetAt(const PidStats_t* stats, u8 index);
+
+u8 PidStats_GetCount(const PidStats_t* stats);
+
+u32 PidStats_GetAchievedIntervalMs(const PidStatsRecord_t* record);
+
+void PidStats_HistogramInit(PidStatsHistogram_t* hist);
+
+void PidStats_HistogramRecord(PidStatsHistogram_t* hist, u32 value);
+
+u32 PidStats_HistogramPercentile(const PidStatsHistogram_t* hist, u16 permille);
+
+u8 PidStats_BucketIndex(u32 value);
+
+u32 PidStats_BucketLowerBound(u8 index);
+
+#endif
@@ -74,7 +74,7 @@ Result_t ReadinessManager_Init(ReadinessManager_t* rm, const ReadinessManagerCon
     rm->error_handler = config->error_handler;
     rm->callback = config->callback;
     rm->callback_context = config->callback_context;
-    rm->get_timestamp_ms = config->get_timestamp_ms;
+    rm->clock = config->clock;
     rm->initialized = true;
     
     return RESULT_OK;
@@ -179,9 +179,7 @@ Result_t ReadinessManager_ProcessResponse(ReadinessManager_t* rm, const u8* data
                            ((byte_d & 0x80U) == 0U));
     }
     
-    if (rm->get_timestamp_ms != NULL_PTR) {
-        rm->data.timestamp_ms = rm->get_timestamp_ms();
-    }
+    rm->data.timestamp_ms = Clock_NowMs(rm->clock);
     
     rm->data.valid = true;
     
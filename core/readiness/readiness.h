@@ -3,6 +3,7 @@
 
 #include "../types.h"
 #include "../error/error_handler.h"
+#include "../clock/clock.h"
 
 typedef enum {
     MONITOR_MISFIRE = 0,
@@ -59,7 +60,7 @@ typedef struct {
     ErrorHandler_t* error_handler;
     ReadinessCallback_t callback;
     void* callback_context;
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
 } ReadinessManagerConfig_t;
 
 typedef struct {
@@ -68,7 +69,7 @@ typedef struct {
     ErrorHandler_t* error_handler;
     ReadinessCallback_t callback;
     void* callback_context;
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
 } ReadinessManager_t;
 
 Result_t ReadinessManager_Init(ReadinessManager_t* rm, const ReadinessManagerConfig_t* config);
@@ -118,7 +118,7 @@ Result_t SanityCheck_Init(SanityCheck_t* sc, const SanityCheckConfig_t* config)
     sc->error_handler = config->error_handler;
     sc->fail_callback = config->fail_callback;
     sc->callback_context = config->callback_context;
-    sc->get_timestamp_ms = config->get_timestamp_ms;
+    sc->clock = config->clock;
     sc->initialized = true;
     
     return RESULT_OK;
@@ -291,10 +291,7 @@ SanityResult_t SanityCheck_ValidatePid(SanityCheck_t* sc, u8 pid, const PidValue
     SanityHistory_t* hist = find_or_create_history(sc, pid);
     if (hist != NULL_PTR) {
         add_to_history(hist, value->eng_value);
-        
-        if (sc->get_timestamp_ms != NULL_PTR) {
-            hist->last_check_ms = sc->get_timestamp_ms();
-        }
+        hist->last_check_ms = Clock_NowMs(sc->clock);
     }
     
     return SANITY_RESULT_OK;
@@ -4,6 +4,7 @@
 #include "../types.h"
 #include "../pid/pid_manager.h"
 #include "../error/error_handler.h"
+#include "../clock/clock.h"
 
 #define SANITY_HISTORY_SIZE 8
 #define SANITY_STUCK_THRESHOLD 5
@@ -43,7 +44,7 @@ typedef struct {
     ErrorHandler_t* error_handler;
     SanityFailCallback_t fail_callback;
     void* callback_context;
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
 } SanityCheckConfig_t;
 
 typedef struct {
@@ -53,7 +54,7 @@ typedef struct {
     ErrorHandler_t* error_handler;
     SanityFailCallback_t fail_callback;
     void* callback_context;
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
     u32 total_checks;
     u32 total_failures;
 } SanityCheck_t;
@@ -16,6 +16,11 @@ static const char* const state_strings[] = {
     [TASK_STATE_DISABLED] = "Disabled"
 };
 
+static const char* const profile_strings[] = {
+    [SCHEDULER_PROFILE_FULL] = "Full",
+    [SCHEDULER_PROFILE_KEEPALIVE] = "Keep-alive"
+};
+
 static SchedulerTask_t* find_task(Scheduler_t* sched, u8 task_id)
 {
     for (u8 i = 0U; i < sched->task_count; i++) {
@@ -49,6 +54,37 @@ static u8 get_next_task_id(const Scheduler_t* sched)
     return max_id + 1U;
 }
 
+static bool task_in_profile(const Scheduler_t* sched, const SchedulerTask_t* task)
+{
+    return (task->profile_mask & SCHEDULER_PROFILE_BIT(sched->profile)) != 0U;
+}
+
+static void apply_profile(Scheduler_t* sched, SchedulerProfile_t profile)
+{
+    if (profile == sched->profile) {
+        return;
+    }
+    
+    sched->profile = profile;
+    
+    if (profile == SCHEDULER_PROFILE_FULL) {
+        u64 current_time = Clock_NowUs(sched->clock);
+        
+        for (u8 i = 0U; i < sched->task_count; i++) {
+            SchedulerTask_t* task = &sched->tasks[i];
+            
+            if ((task->enabled == true) &&
+                ((task->profile_mask & SCHEDULER_PROFILE_BIT(SCHEDULER_PROFILE_KEEPALIVE)) == 0U)) {
+                task->next_run_us = current_time;
+            }
+        }
+    }
+    
+    if (sched->profile_callback != NULL_PTR) {
+        sched->profile_callback(profile, sched->callback_context);
+    }
+}
+
 Result_t Scheduler_Init(Scheduler_t* sched, const SchedulerConfig_t* config)
 {
     if (sched == NULL_PTR) {
@@ -59,18 +95,28 @@ Result_t Scheduler_Init(Scheduler_t* sched, const SchedulerConfig_t* config)
         return RESULT_INVALID_PARAM;
     }
     
-    if (config->get_timestamp_ms == NULL_PTR) {
+    if (config->clock == NULL_PTR) {
         return RESULT_INVALID_PARAM;
     }
     
     sched->task_count = 0U;
     sched->running = false;
-    sched->get_timestamp_ms = config->get_timestamp_ms;
+    sched->clock = config->clock;
     sched->error_handler = config->error_handler;
     sched->complete_callback = config->complete_callback;
     sched->callback_context = config->callback_context;
     sched->total_runs = 0U;
     sched->total_errors = 0U;
+    sched->profile = SCHEDULER_PROFILE_FULL;
+    sched->profile_callback = config->profile_callback;
+    sched->engine_off_since_us = 0U;
+    sched->engine_off_pending = false;
+    
+    if (config->engine_off_delay_ms == 0U) {
+        sched->engine_off_delay_ms = SCHEDULER_ENGINE_OFF_DELAY_MS;
+    } else {
+        sched->engine_off_delay_ms = config->engine_off_delay_ms;
+    }
     
     if (config->min_interval_ms < SCHEDULER_MIN_INTERVAL_MS) {
         sched->min_interval_ms = SCHEDULER_MIN_INTERVAL_MS;
@@ -138,14 +184,14 @@ Result_t Scheduler_AddTask(Scheduler_t* sched,
     task->priority = priority;
     task->state = TASK_STATE_IDLE;
     task->interval_ms = actual_interval;
-    task->last_run_ms = 0U;
+    task->last_run_us = 0U;
     task->run_count = 0U;
     task->error_count = 0U;
     task->enabled = true;
     task->one_shot = one_shot;
+    task->profile_mask = SCHEDULER_PROFILE_ALL;
     
-    u32 current_time = sched->get_timestamp_ms();
-    task->next_run_ms = current_time + actual_interval;
+    task->next_run_us = Clock_NowUs(sched->clock) + CLOCK_MS_TO_US(actual_interval);
     
     sched->task_count++;
     
@@ -202,7 +248,7 @@ Result_t Scheduler_EnableTask(Scheduler_t* sched, u8 task_id)
     
     task->enabled = true;
     task->state = TASK_STATE_IDLE;
-    task->next_run_ms = sched->get_timestamp_ms() + task->interval_ms;
+    task->next_run_us = Clock_NowUs(sched->clock) + CLOCK_MS_TO_US(task->interval_ms);
     
     return RESULT_OK;
 }
@@ -297,7 +343,85 @@ Result_t Scheduler_TriggerTask(Scheduler_t* sched, u8 task_id)
     }
     
     task->state = TASK_STATE_PENDING;
-    task->next_run_ms = sched->get_timestamp_ms();
+    task->next_run_us = Clock_NowUs(sched->clock);
+    
+    return RESULT_OK;
+}
+
+Result_t Scheduler_SetTaskProfiles(Scheduler_t* sched, u8 task_id, u8 profile_mask)
+{
+    if (sched == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (sched->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    SchedulerTask_t* task = find_task(sched, task_id);
+    
+    if (task == NULL_PTR) {
+        return RESULT_ERROR;
+    }
+    
+    task->profile_mask = profile_mask;
+    
+    return RESULT_OK;
+}
+
+Result_t Scheduler_SetProfile(Scheduler_t* sched, SchedulerProfile_t profile)
+{
+    if (sched == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (sched->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (profile >= SCHEDULER_PROFILE_MAX) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    sched->engine_off_pending = false;
+    apply_profile(sched, profile);
+    
+    return RESULT_OK;
+}
+
+SchedulerProfile_t Scheduler_GetProfile(const Scheduler_t* sched)
+{
+    if (sched == NULL_PTR) {
+        return SCHEDULER_PROFILE_FULL;
+    }
+    
+    return sched->profile;
+}
+
+Result_t Scheduler_FeedEngineState(Scheduler_t* sched, float rpm, float speed_kmh)
+{
+    if (sched == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (sched->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if ((rpm > 0.0f) || (speed_kmh > 0.0f)) {
+        sched->engine_off_pending = false;
+        apply_profile(sched, SCHEDULER_PROFILE_FULL);
+        return RESULT_OK;
+    }
+    
+    if (sched->engine_off_pending == false) {
+        sched->engine_off_pending = true;
+        sched->engine_off_since_us = Clock_NowUs(sched->clock);
+    }
+    
+    if (Clock_ElapsedMs(sched->clock, sched->engine_off_since_us) >= sched->engine_off_delay_ms) {
+        apply_profile(sched, SCHEDULER_PROFILE_KEEPALIVE);
+    }
     
     return RESULT_OK;
 }
@@ -316,11 +440,11 @@ Result_t Scheduler_Update(Scheduler_t* sched)
         return RESULT_OK;
     }
     
-    u32 current_time = sched->get_timestamp_ms();
+    u64 current_time = Clock_NowUs(sched->clock);
     
     SchedulerTask_t* best_task = NULL_PTR;
     TaskPriority_t best_priority = TASK_PRIORITY_MAX;
-    u32 earliest_due = 0xFFFFFFFFU;
+    u64 earliest_due = 0xFFFFFFFFFFFFFFFFULL;
     
     for (u8 i = 0U; i < sched->task_count; i++) {
         SchedulerTask_t* task = &sched->tasks[i];
@@ -333,20 +457,16 @@ Result_t Scheduler_Update(Scheduler_t* sched)
             continue;
         }
         
-        bool is_due = false;
-        
-        if (current_time >= task->next_run_ms) {
-            is_due = true;
-        } else if ((task->next_run_ms - current_time) > 0x7FFFFFFFU) {
-            is_due = true;
+        if (task_in_profile(sched, task) == false) {
+            continue;
         }
         
-        if (is_due == true) {
+        if (current_time >= task->next_run_us) {
             if ((task->priority < best_priority) ||
-                ((task->priority == best_priority) && (task->next_run_ms < earliest_due))) {
+                ((task->priority == best_priority) && (task->next_run_us < earliest_due))) {
                 best_task = task;
                 best_priority = task->priority;
-                earliest_due = task->next_run_ms;
+                earliest_due = task->next_run_us;
             }
         }
     }
@@ -356,7 +476,7 @@ Result_t Scheduler_Update(Scheduler_t* sched)
         
         Result_t result = best_task->function(best_task->context);
         
-        best_task->last_run_ms = current_time;
+        best_task->last_run_us = current_time;
         best_task->run_count++;
         sched->total_runs++;
         
@@ -374,7 +494,7 @@ Result_t Scheduler_Update(Scheduler_t* sched)
             best_task->state = TASK_STATE_DISABLED;
         } else {
             best_task->state = TASK_STATE_IDLE;
-            best_task->next_run_ms = current_time + best_task->interval_ms;
+            best_task->next_run_us = current_time + CLOCK_MS_TO_US(best_task->interval_ms);
         }
     }
     
@@ -391,12 +511,12 @@ Result_t Scheduler_Start(Scheduler_t* sched)
         return RESULT_NOT_READY;
     }
     
-    u32 current_time = sched->get_timestamp_ms();
+    u64 current_time = Clock_NowUs(sched->clock);
     
     for (u8 i = 0U; i < sched->task_count; i++) {
         if (sched->tasks[i].enabled == true) {
             sched->tasks[i].state = TASK_STATE_IDLE;
-            sched->tasks[i].next_run_ms = current_time + sched->tasks[i].interval_ms;
+            sched->tasks[i].next_run_us = current_time + CLOCK_MS_TO_US(sched->tasks[i].interval_ms);
         }
     }
     
@@ -481,8 +601,7 @@ Result_t Scheduler_GetNextTask(const Scheduler_t* sched, u8* task_id, u32* time_
         return RESULT_NOT_READY;
     }
     
-    u32 current_time = sched->get_timestamp_ms();
-    u32 earliest_time = 0xFFFFFFFFU;
+    u64 earliest_time = 0xFFFFFFFFFFFFFFFFULL;
     u8 earliest_id = 0xFFU;
     
     for (u8 i = 0U; i < sched->task_count; i++) {
@@ -492,8 +611,8 @@ Result_t Scheduler_GetNextTask(const Scheduler_t* sched, u8* task_id, u32* time_
             continue;
         }
         
-        if (task->next_run_ms < earliest_time) {
-            earliest_time = task->next_run_ms;
+        if (task->next_run_us < earliest_time) {
+            earliest_time = task->next_run_us;
             earliest_id = task->id;
         }
     }
@@ -507,8 +626,10 @@ Result_t Scheduler_GetNextTask(const Scheduler_t* sched, u8* task_id, u32* time_
     }
     
     if (time_until_ms != NULL_PTR) {
+        u64 current_time = Clock_NowUs(sched->clock);
+        
         if (earliest_time > current_time) {
-            *time_until_ms = earliest_time - current_time;
+            *time_until_ms = (u32)((earliest_time - current_time + CLOCK_US_PER_MS - 1U) / CLOCK_US_PER_MS);
         } else {
             *time_until_ms = 0U;
         }
@@ -534,3 +655,12 @@ const char* Scheduler_GetStateString(TaskState_t state)
     
     return state_strings[state];
 }
+
+const char* Scheduler_GetProfileString(SchedulerProfile_t profile)
+{
+    if (profile >= SCHEDULER_PROFILE_MAX) {
+        return "Unknown";
+    }
+    
+    return profile_strings[profile];
+}
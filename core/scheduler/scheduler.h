@@ -3,9 +3,13 @@
 
 #include "../types.h"
 #include "../error/error_handler.h"
+#include "../clock/clock.h"
 
 #define SCHEDULER_MAX_TASKS 16
 #define SCHEDULER_MIN_INTERVAL_MS 10
+#define SCHEDULER_ENGINE_OFF_DELAY_MS 30000
+#define SCHEDULER_PROFILE_BIT(profile) ((u8)(1U << (profile)))
+#define SCHEDULER_PROFILE_ALL 0xFF
 
 typedef enum {
     TASK_PRIORITY_CRITICAL = 0,
@@ -25,8 +29,15 @@ typedef enum {
     TASK_STATE_MAX
 } TaskState_t;
 
+typedef enum {
+    SCHEDULER_PROFILE_FULL = 0,
+    SCHEDULER_PROFILE_KEEPALIVE = 1,
+    SCHEDULER_PROFILE_MAX
+} SchedulerProfile_t;
+
 typedef Result_t (*TaskFunction_t)(void* context);
 typedef void (*TaskCompleteCallback_t)(u8 task_id, Result_t result, void* context);
+typedef void (*SchedulerProfileCallback_t)(SchedulerProfile_t profile, void* context);
 
 typedef struct {
     u8 id;
@@ -36,20 +47,23 @@ typedef struct {
     TaskPriority_t priority;
     TaskState_t state;
     u16 interval_ms;
-    u32 last_run_ms;
-    u32 next_run_ms;
+    u64 last_run_us;
+    u64 next_run_us;
     u16 run_count;
     u16 error_count;
     bool enabled;
     bool one_shot;
+    u8 profile_mask;
 } SchedulerTask_t;
 
 typedef struct {
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
     ErrorHandler_t* error_handler;
     TaskCompleteCallback_t complete_callback;
     void* callback_context;
     u16 min_interval_ms;
+    SchedulerProfileCallback_t profile_callback;
+    u32 engine_off_delay_ms;
 } SchedulerConfig_t;
 
 typedef struct {
@@ -57,13 +71,18 @@ typedef struct {
     u8 task_count;
     bool running;
     bool initialized;
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
     ErrorHandler_t* error_handler;
     TaskCompleteCallback_t complete_callback;
     void* callback_context;
     u16 min_interval_ms;
     u32 total_runs;
     u32 total_errors;
+    SchedulerProfile_t profile;
+    SchedulerProfileCallback_t profile_callback;
+    u32 engine_off_delay_ms;
+    u64 engine_off_since_us;
+    bool engine_off_pending;
 } Scheduler_t;
 
 Result_t Scheduler_Init(Scheduler_t* sched, const SchedulerConfig_t* config);
@@ -89,6 +108,14 @@ Result_t Scheduler_SetPriority(Scheduler_t* sched, u8 task_id, TaskPriority_t pr
 
 Result_t Scheduler_TriggerTask(Scheduler_t* sched, u8 task_id);
 
+Result_t Scheduler_SetTaskProfiles(Scheduler_t* sched, u8 task_id, u8 profile_mask);
+
+Result_t Scheduler_SetProfile(Scheduler_t* sched, SchedulerProfile_t profile);
+
+SchedulerProfile_t Scheduler_GetProfile(const Scheduler_t* sched);
+
+Result_t Scheduler_FeedEngineState(Scheduler_t* sched, float rpm, float speed_kmh);
+
 Result_t Scheduler_Update(Scheduler_t* sched);
 
 Result_t Scheduler_Start(Scheduler_t* sched);
@@ -107,4 +134,6 @@ const char* Scheduler_GetPriorityString(TaskPriority_t priority);
 
 const char* Scheduler_GetStateString(TaskState_t state);
 
+const char* Scheduler_GetProfileString(SchedulerProfile_t profile);
+
 #endif
@@ -135,10 +135,7 @@ static void execute_transition(StateMachine_t* sm, State_t new_state, Event_t ev
     sm->previous_state = sm->current_state;
     sm->current_state = new_state;
     sm->retry_count = 0U;
-    
-    if (sm->get_timestamp_ms != NULL_PTR) {
-        sm->state_entry_time_ms = sm->get_timestamp_ms();
-    }
+    sm->state_entry_time_us = Clock_NowUs(sm->clock);
     
     if (sm->transition_callback != NULL_PTR) {
         sm->transition_callback(sm->previous_state, sm->current_state, event, sm->context);
@@ -164,19 +161,15 @@ Result_t StateMachine_Init(StateMachine_t* sm, const StateMachineConfig_t* confi
     
     sm->current_state = STATE_DISCONNECTED;
     sm->previous_state = STATE_DISCONNECTED;
-    sm->state_entry_time_ms = 0U;
     sm->retry_count = 0U;
     sm->context = config->context;
     sm->transition_callback = config->transition_callback;
-    sm->get_timestamp_ms = config->get_timestamp_ms;
+    sm->clock = config->clock;
     sm->state_configs = config->state_configs;
     sm->error_handler = config->error_handler;
+    sm->state_entry_time_us = Clock_NowUs(sm->clock);
     sm->initialized = true;
     
-    if (sm->get_timestamp_ms != NULL_PTR) {
-        sm->state_entry_time_ms = sm->get_timestamp_ms();
-    }
-    
     return RESULT_OK;
 }
 
@@ -229,9 +222,7 @@ Result_t StateMachine_Update(StateMachine_t* sm)
             
             if (sm->retry_count < config->max_retries) {
                 sm->retry_count++;
-                if (sm->get_timestamp_ms != NULL_PTR) {
-                    sm->state_entry_time_ms = sm->get_timestamp_ms();
-                }
+                sm->state_entry_time_us = Clock_NowUs(sm->clock);
             } else {
                 Result_t result = StateMachine_ProcessEvent(sm, EVENT_TIMEOUT);
                 UNUSED(result);
@@ -291,17 +282,7 @@ u32 StateMachine_GetTimeInState(const StateMachine_t* sm)
         return 0U;
     }
     
-    if (sm->get_timestamp_ms == NULL_PTR) {
-        return 0U;
-    }
-    
-    u32 current_time = sm->get_timestamp_ms();
-    
-    if (current_time >= sm->state_entry_time_ms) {
-        return current_time - sm->state_entry_time_ms;
-    }
-    
-    return (0xFFFFFFFFU - sm->state_entry_time_ms) + current_time + 1U;
+    return Clock_ElapsedMs(sm->clock, sm->state_entry_time_us);
 }
 
 bool StateMachine_IsTimedOut(const StateMachine_t* sm)
@@ -3,6 +3,7 @@
 
 #include "../types.h"
 #include "../error/error_handler.h"
+#include "../clock/clock.h"
 
 typedef enum {
     STATE_DISCONNECTED = 0,
@@ -67,12 +68,12 @@ typedef struct {
 typedef struct {
     State_t current_state;
     State_t previous_state;
-    u32 state_entry_time_ms;
+    u64 state_entry_time_us;
     u8 retry_count;
     bool initialized;
     void* context;
     StateTransitionCallback_t transition_callback;
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
     const StateConfig_t* state_configs;
     ErrorHandler_t* error_handler;
 } StateMachine_t;
@@ -80,7 +81,7 @@ typedef struct {
 typedef struct {
     void* context;
     StateTransitionCallback_t transition_callback;
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
     const StateConfig_t* state_configs;
     ErrorHandler_t* error_handler;
 } StateMachineConfig_t;
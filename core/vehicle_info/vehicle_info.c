@@ -67,7 +67,7 @@ Result_t VehicleInfoManager_Init(VehicleInfoManager_t* vim, const VehicleInfoMan
     vim->error_handler = config->error_handler;
     vim->callback = config->callback;
     vim->callback_context = config->callback_context;
-    vim->get_timestamp_ms = config->get_timestamp_ms;
+    vim->clock = config->clock;
     vim->initialized = true;
     
     return RESULT_OK;
@@ -90,9 +90,7 @@ Result_t VehicleInfoManager_ProcessResponse(VehicleInfoManager_t* vim,
         return RESULT_NOT_READY;
     }
     
-    if (vim->get_timestamp_ms != NULL_PTR) {
-        vim->info.timestamp_ms = vim->get_timestamp_ms();
-    }
+    vim->info.timestamp_ms = Clock_NowMs(vim->clock);
     
     switch (type) {
         case VEHICLE_INFO_VIN: {
@@ -4,6 +4,7 @@
 #include "../types.h"
 #include "../obd2/obd2.h"
 #include "../error/error_handler.h"
+#include "../clock/clock.h"
 
 #define VIN_LENGTH 17
 #define CALIBRATION_ID_LENGTH 16
@@ -46,7 +47,7 @@ typedef struct {
     ErrorHandler_t* error_handler;
     VehicleInfoCallback_t callback;
     void* callback_context;
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
 } VehicleInfoManagerConfig_t;
 
 typedef struct {
@@ -55,7 +56,7 @@ typedef struct {
     ErrorHandler_t* error_handler;
     VehicleInfoCallback_t callback;
     void* callback_context;
-    u32 (*get_timestamp_ms)(void);
+    const Clock_t* clock;
     u8 vin_buffer[20];
     u8 vin_buffer_idx;
 } VehicleInfoManager_t;
@@ -19,7 +19,9 @@ static const char* const event_strings[] = {
     [BT_EVENT_DISCONNECTED] = "Disconnected",
     [BT_EVENT_DATA_RECEIVED] = "Data Received",
     [BT_EVENT_WRITE_COMPLETE] = "Write Complete",
-    [BT_EVENT_ERROR] = "Error"
+    [BT_EVENT_ERROR] = "Error",
+    [BT_EVENT_RX_HIGH_WATERMARK] = "RX High Watermark",
+    [BT_EVENT_RX_LOW_WATERMARK] = "RX Low Watermark"
 };
 
 static void rx_buffer_init(BluetoothRxBuffer_t* buf)
@@ -29,17 +31,23 @@ static void rx_buffer_init(BluetoothRxBuffer_t* buf)
     buf->count = 0U;
 }
 
-static bool rx_buffer_push(BluetoothRxBuffer_t* buf, u8 byte)
+static u16 rx_buffer_write(BluetoothRxBuffer_t* buf, const u8* data, u16 length)
 {
-    if (buf->count >= BT_RX_BUFFER_SIZE) {
-        return false;
+    u16 free_space = (u16)(BT_RX_BUFFER_SIZE - buf->count);
+    u16 accepted = (length < free_space) ? length : free_space;
+    u16 first = (u16)(BT_RX_BUFFER_SIZE - buf->head);
+    
+    if (first > accepted) {
+        first = accepted;
     }
     
-    buf->buffer[buf->head] = byte;
-    buf->head = (buf->head + 1U) % BT_RX_BUFFER_SIZE;
-    buf->count++;
+    memcpy(&buf->buffer[buf->head], data, first);
+    memcpy(&buf->buffer[0], &data[first], (size_t)(accepted - first));
     
-    return true;
+    buf->head = (u16)((buf->head + accepted) % BT_RX_BUFFER_SIZE);
+    buf->count = (u16)(buf->count + accepted);
+    
+    return accepted;
 }
 
 static bool rx_buffer_pop(BluetoothRxBuffer_t* buf, u8* byte)
@@ -55,6 +63,214 @@ static bool rx_buffer_pop(BluetoothRxBuffer_t* buf, u8* byte)
     return true;
 }
 
+static void rx_timing_init(BluetoothRxTiming_t* timing)
+{
+    timing->head = 0U;
+    timing->count = 0U;
+    timing->write_offset = 0U;
+    timing->read_offset = 0U;
+}
+
+static void rx_timing_stamp(BluetoothRxTiming_t* timing, u64 arrival_us)
+{
+    if (timing->count >= BT_RX_STAMP_DEPTH) {
+        return;
+    }
+    
+    timing->stamps[timing->head].stream_offset = timing->write_offset;
+    timing->stamps[timing->head].arrival_us = arrival_us;
+    timing->head = (u16)((timing->head + 1U) % BT_RX_STAMP_DEPTH);
+    timing->count++;
+}
+
+static void rx_timing_release(BluetoothRxTiming_t* timing)
+{
+    while (timing->count > 1U) {
+        u16 next = (u16)((timing->head + BT_RX_STAMP_DEPTH - timing->count + 1U) % BT_RX_STAMP_DEPTH);
+        
+        if ((i32)(timing->read_offset - timing->stamps[next].stream_offset) < 0) {
+            break;
+        }
+        
+        timing->count--;
+    }
+}
+
+static bool rx_timing_lookup(const BluetoothRxTiming_t* timing, u32 stream_offset, u64* arrival_us)
+{
+    for (u16 i = 0U; i < timing->count; i++) {
+        u16 idx = (u16)((timing->head + BT_RX_STAMP_DEPTH - 1U - i) % BT_RX_STAMP_DEPTH);
+        const BluetoothRxStamp_t* stamp = &timing->stamps[idx];
+        
+        if ((i32)(stream_offset - stamp->stream_offset) >= 0) {
+            *arrival_us = stamp->arrival_us;
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+static void notify_event(BluetoothInterface_t* bt, BluetoothEvent_t event, const void* data)
+{
+    if (bt->event_callback != NULL_PTR) {
+        bt->event_callback(event, data, bt->callback_context);
+    }
+}
+
+static void reset_rx(BluetoothInterface_t* bt)
+{
+    rx_buffer_init(&bt->rx_buffer);
+    rx_timing_init(&bt->rx_timing);
+    bt->rx_throttled = false;
+    bt->rx_notify_pending = 0U;
+    bt->rx_pending_since_us = 0U;
+}
+
+static void flush_rx_notification(BluetoothInterface_t* bt)
+{
+    if (bt->rx_notify_pending == 0U) {
+        return;
+    }
+    
+    u16 pending = (bt->rx_notify_pending > BT_RX_BUFFER_SIZE) ? (u16)BT_RX_BUFFER_SIZE : (u16)bt->rx_notify_pending;
+    bt->rx_notify_pending = 0U;
+    bt->rx_notify_count++;
+    
+    notify_event(bt, BT_EVENT_DATA_RECEIVED, &pending);
+}
+
+static void reset_tx(BluetoothInterface_t* bt)
+{
+    bt->tx_pending = 0U;
+    bt->tx_sent = 0U;
+    bt->tx_credits = bt->tx_max_credits;
+    bt->tx_awaiting_response = false;
+}
+
+static Result_t tx_pump(BluetoothInterface_t* bt)
+{
+    while (bt->tx_sent < bt->tx_pending) {
+        if (bt->tx_write_type == BT_WRITE_WITHOUT_RESPONSE) {
+            if (bt->tx_credits == 0U) {
+                return RESULT_OK;
+            }
+        } else if (bt->tx_awaiting_response == true) {
+            return RESULT_OK;
+        }
+        
+        u16 chunk = (u16)(bt->tx_pending - bt->tx_sent);
+        
+        if (chunk > bt->tx_chunk_size) {
+            chunk = bt->tx_chunk_size;
+        }
+        
+        Result_t result = bt->transmit_callback(&bt->tx_buffer[bt->tx_sent], chunk, bt->tx_write_type, bt->callback_context);
+        
+        if (result != RESULT_OK) {
+            reset_tx(bt);
+            notify_event(bt, BT_EVENT_ERROR, &result);
+            return result;
+        }
+        
+        bt->tx_sent += chunk;
+        bt->tx_chunk_count++;
+        
+        if (bt->tx_write_type == BT_WRITE_WITHOUT_RESPONSE) {
+            bt->tx_credits--;
+        } else {
+            bt->tx_awaiting_response = true;
+        }
+        
+        if (bt->tx_sent == bt->tx_pending) {
+            bt->last_tx_us = Clock_SampleUs(bt->clock);
+        }
+    }
+    
+    if (bt->tx_awaiting_response == false) {
+        bt->tx_pending = 0U;
+        bt->tx_sent = 0U;
+        notify_event(bt, BT_EVENT_WRITE_COMPLETE, NULL_PTR);
+    }
+    
+    return RESULT_OK;
+}
+
+static u32 hash_string(const char* str, u8 max_len)
+{
+    u32 hash = 2166136261U;
+    
+    for (u8 i = 0U; (i < max_len) && (str[i] != '\0'); i++) {
+        hash ^= (u8)str[i];
+        hash *= 16777619U;
+    }
+    
+    return hash;
+}
+
+static void reset_seen_devices(BluetoothInterface_t* bt)
+{
+    for (u8 i = 0U; i < BT_SEEN_DEVICES_MAX; i++) {
+        bt->seen_devices[i].valid = false;
+    }
+    
+    bt->seen_next = 0U;
+}
+
+static bool track_found_device(BluetoothInterface_t* bt, const BluetoothDevice_t* device, i8* smoothed_rssi)
+{
+    u32 hash = hash_string(device->uuid, BT_UUID_STRING_MAX);
+    u32 name_hash = hash_string(device->name, BT_DEVICE_NAME_MAX);
+    i16 target = (i16)(device->rssi * (1 << BT_RSSI_SMOOTHING_SHIFT));
+    BluetoothSeenDevice_t* seen = NULL_PTR;
+    
+    for (u8 i = 0U; i < BT_SEEN_DEVICES_MAX; i++) {
+        if ((bt->seen_devices[i].valid == true) && (bt->seen_devices[i].uuid_hash == hash)) {
+            seen = &bt->seen_devices[i];
+            break;
+        }
+    }
+    
+    if (seen == NULL_PTR) {
+        seen = &bt->seen_devices[bt->seen_next];
+        bt->seen_next = (u8)((bt->seen_next + 1U) % BT_SEEN_DEVICES_MAX);
+        seen->uuid_hash = hash;
+        seen->name_hash = name_hash;
+        seen->is_elm327 = device->is_elm327;
+        seen->rssi_q = target;
+        seen->reported_rssi = device->rssi;
+        seen->valid = true;
+        *smoothed_rssi = device->rssi;
+        return true;
+    }
+    
+    seen->rssi_q = (i16)(seen->rssi_q + ((target - seen->rssi_q) / (1 << BT_RSSI_SMOOTHING_SHIFT)));
+    *smoothed_rssi = (i8)(seen->rssi_q / (1 << BT_RSSI_SMOOTHING_SHIFT));
+    
+    i16 delta = (i16)(*smoothed_rssi - seen->reported_rssi);
+    bool changed = (seen->name_hash != name_hash) || (seen->is_elm327 != device->is_elm327);
+    
+    if ((changed == false) && (delta < BT_RSSI_REPORT_DELTA) && (delta > -BT_RSSI_REPORT_DELTA)) {
+        return false;
+    }
+    
+    seen->name_hash = name_hash;
+    seen->is_elm327 = device->is_elm327;
+    seen->reported_rssi = *smoothed_rssi;
+    return true;
+}
+
+static BluetoothAdapterCacheEntry_t* find_adapter_entry(BluetoothAdapterCache_t* cache, const char* uuid)
+{
+    for (u8 i = 0U; i < BT_ADAPTER_CACHE_SIZE; i++) {
+        if ((cache->entries[i].valid == true) &&
+            (strncmp(cache->entries[i].uuid, uuid, BT_UUID_STRING_MAX) == 0)) {
+            return &cache->entries[i];
+        }
+    }
+    return NULL_PTR;
+}
+
 static void copy_string_safe(char* dest, const char* src, size_t max_len)
 {
     if ((dest == NULL_PTR) || (max_len == 0U)) {
@@ -88,14 +304,41 @@ Result_t Bluetooth_Init(BluetoothInterface_t* bt, const BluetoothConfig_t* confi
     bt->connected_device.valid = false;
     bt->connected_device.name[0] = '\0';
     bt->connected_device.uuid[0] = '\0';
-    bt->tx_pending = 0U;
+    bt->tx_chunk_size = BT_ATT_DEFAULT_MTU - BT_ATT_HEADER_SIZE;
+    bt->tx_write_type = BT_WRITE_WITH_RESPONSE;
+    bt->tx_max_credits = BT_TX_DEFAULT_CREDITS;
+    bt->tx_chunk_count = 0U;
+    bt->transmit_callback = config->transmit_callback;
+    bt->last_tx_us = 0U;
+    bt->scan_active = false;
+    bt->duplicate_found_count = 0U;
+    bt->adapter_cache = NULL_PTR;
     bt->platform_handle = NULL_PTR;
     
-    rx_buffer_init(&bt->rx_buffer);
+    reset_seen_devices(bt);
+    
+    reset_tx(bt);
+    
+    reset_rx(bt);
+    bt->rx_dropped_bytes = 0U;
+    bt->rx_chunk_count = 0U;
+    bt->rx_notify_count = 0U;
+    bt->rx_coalesce_us = (config->rx_coalesce_us > 0U) ? config->rx_coalesce_us : BT_RX_COALESCE_DEFAULT_US;
+    bt->rx_high_watermark = (config->rx_high_watermark > 0U) ? config->rx_high_watermark : BT_RX_HIGH_WATERMARK;
+    bt->rx_low_watermark = (config->rx_low_watermark > 0U) ? config->rx_low_watermark : BT_RX_LOW_WATERMARK;
+    
+    if (bt->rx_high_watermark > BT_RX_BUFFER_SIZE) {
+        bt->rx_high_watermark = BT_RX_BUFFER_SIZE;
+    }
+    
+    if (bt->rx_low_watermark >= bt->rx_high_watermark) {
+        bt->rx_low_watermark = bt->rx_high_watermark / 2U;
+    }
     
     bt->event_callback = config->event_callback;
     bt->callback_context = config->callback_context;
     bt->error_handler = config->error_handler;
+    bt->clock = config->clock;
     bt->initialized = true;
     
     return RESULT_OK;
@@ -136,7 +379,12 @@ Result_t Bluetooth_StartScan(BluetoothInterface_t* bt)
         return RESULT_BUSY;
     }
     
-    bt->state = BT_STATE_SCANNING;
+    reset_seen_devices(bt);
+    bt->scan_active = true;
+    
+    if (bt->state != BT_STATE_CONNECTING) {
+        bt->state = BT_STATE_SCANNING;
+    }
     
     return RESULT_OK;
 }
@@ -151,6 +399,8 @@ Result_t Bluetooth_StopScan(BluetoothInterface_t* bt)
         return RESULT_NOT_READY;
     }
     
+    bt->scan_active = false;
+    
     if (bt->state == BT_STATE_SCANNING) {
         bt->state = BT_STATE_DISCONNECTED;
     }
@@ -198,8 +448,10 @@ Result_t Bluetooth_Disconnect(BluetoothInterface_t* bt)
     
     bt->state = BT_STATE_DISCONNECTED;
     bt->connected_device.valid = false;
+    bt->scan_active = false;
     
-    rx_buffer_init(&bt->rx_buffer);
+    reset_rx(bt);
+    reset_tx(bt);
     
     if (bt->event_callback != NULL_PTR) {
         bt->event_callback(BT_EVENT_DISCONNECTED, NULL_PTR, bt->callback_context);
@@ -226,19 +478,40 @@ Result_t Bluetooth_Write(BluetoothInterface_t* bt, const u8* data, u16 length)
         return RESULT_NOT_READY;
     }
     
-    if (length > BT_TX_BUFFER_SIZE) {
-        return RESULT_BUFFER_FULL;
+    if (bt->transmit_callback == NULL_PTR) {
+        if (length > BT_TX_BUFFER_SIZE) {
+            return RESULT_BUFFER_FULL;
+        }
+        
+        for (u16 i = 0U; i < length; i++) {
+            bt->tx_buffer[i] = data[i];
+        }
+        bt->tx_pending = length;
+        bt->last_tx_us = Clock_SampleUs(bt->clock);
+        
+        return RESULT_OK;
     }
     
-    for (u16 i = 0U; i < length; i++) {
-        bt->tx_buffer[i] = data[i];
+    if (length > (BT_TX_BUFFER_SIZE - bt->tx_pending)) {
+        return (bt->tx_pending > 0U) ? RESULT_BUSY : RESULT_BUFFER_FULL;
     }
-    bt->tx_pending = length;
     
-    return RESULT_OK;
+    memcpy(&bt->tx_buffer[bt->tx_pending], data, length);
+    bt->tx_pending += length;
+    
+    return tx_pump(bt);
 }
 
 Result_t Bluetooth_Read(BluetoothInterface_t* bt, u8* buffer, u16 max_length, u16* actual_length)
+{
+    return Bluetooth_ReadTimed(bt, buffer, max_length, actual_length, NULL_PTR);
+}
+
+Result_t Bluetooth_ReadTimed(BluetoothInterface_t* bt,
+                             u8* buffer,
+                             u16 max_length,
+                             u16* actual_length,
+                             u64* first_arrival_us)
 {
     if (bt == NULL_PTR) {
         return RESULT_INVALID_PARAM;
@@ -256,6 +529,13 @@ Result_t Bluetooth_Read(BluetoothInterface_t* bt, u8* buffer, u16 max_length, u1
         return RESULT_NOT_READY;
     }
     
+    if (first_arrival_us != NULL_PTR) {
+        if ((bt->rx_buffer.count == 0U) ||
+            (rx_timing_lookup(&bt->rx_timing, bt->rx_timing.read_offset, first_arrival_us) == false)) {
+            *first_arrival_us = 0U;
+        }
+    }
+    
     *actual_length = 0U;
     u16 idx = 0U;
     u8 byte;
@@ -265,11 +545,153 @@ Result_t Bluetooth_Read(BluetoothInterface_t* bt, u8* buffer, u16 max_length, u1
         idx++;
     }
     
+    bt->rx_timing.read_offset += idx;
+    rx_timing_release(&bt->rx_timing);
     *actual_length = idx;
     
+    if ((bt->rx_throttled == true) && (bt->rx_buffer.count <= bt->rx_low_watermark)) {
+        bt->rx_throttled = false;
+        notify_event(bt, BT_EVENT_RX_LOW_WATERMARK, &bt->rx_buffer.count);
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t Bluetooth_GetArrivalTime(const BluetoothInterface_t* bt, u32 stream_offset, u64* arrival_us)
+{
+    if (bt == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (arrival_us == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (bt->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (rx_timing_lookup(&bt->rx_timing, stream_offset, arrival_us) == false) {
+        return RESULT_NO_DATA;
+    }
+    
     return RESULT_OK;
 }
 
+u32 Bluetooth_GetReadOffset(const BluetoothInterface_t* bt)
+{
+    if (bt == NULL_PTR) {
+        return 0U;
+    }
+    
+    return bt->rx_timing.read_offset;
+}
+
+u64 Bluetooth_GetLastWriteTime(const BluetoothInterface_t* bt)
+{
+    if (bt == NULL_PTR) {
+        return 0U;
+    }
+    
+    return bt->last_tx_us;
+}
+
+Result_t Bluetooth_SetLinkParameters(BluetoothInterface_t* bt,
+                                     u16 att_mtu,
+                                     BluetoothWriteType_t write_type,
+                                     u8 max_credits)
+{
+    if (bt == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (att_mtu < BT_ATT_DEFAULT_MTU) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (write_type >= BT_WRITE_TYPE_MAX) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (bt->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (bt->tx_sent < bt->tx_pending) {
+        return RESULT_BUSY;
+    }
+    
+    bt->tx_chunk_size = (u16)(att_mtu - BT_ATT_HEADER_SIZE);
+    bt->tx_write_type = write_type;
+    bt->tx_max_credits = (max_credits > 0U) ? max_credits : BT_TX_DEFAULT_CREDITS;
+    bt->tx_credits = bt->tx_max_credits;
+    
+    return RESULT_OK;
+}
+
+Result_t Bluetooth_OnTxReady(BluetoothInterface_t* bt, u8 credits)
+{
+    if (bt == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (bt->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    u16 total = (u16)bt->tx_credits + credits;
+    bt->tx_credits = (total > bt->tx_max_credits) ? bt->tx_max_credits : (u8)total;
+    
+    if ((bt->transmit_callback != NULL_PTR) && (bt->tx_pending > 0U)) {
+        (void)tx_pump(bt);
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t Bluetooth_OnWriteComplete(BluetoothInterface_t* bt, Result_t result)
+{
+    if (bt == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (bt->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    bt->tx_awaiting_response = false;
+    
+    if (result != RESULT_OK) {
+        reset_tx(bt);
+        notify_event(bt, BT_EVENT_ERROR, &result);
+        return RESULT_OK;
+    }
+    
+    if ((bt->transmit_callback != NULL_PTR) && (bt->tx_pending > 0U)) {
+        (void)tx_pump(bt);
+    }
+    
+    return RESULT_OK;
+}
+
+u16 Bluetooth_GetTxChunkSize(const BluetoothInterface_t* bt)
+{
+    if (bt == NULL_PTR) {
+        return 0U;
+    }
+    
+    return bt->tx_chunk_size;
+}
+
+u32 Bluetooth_GetTxChunkCount(const BluetoothInterface_t* bt)
+{
+    if (bt == NULL_PTR) {
+        return 0U;
+    }
+    
+    return bt->tx_chunk_count;
+}
+
 u16 Bluetooth_GetAvailableBytes(const BluetoothInterface_t* bt)
 {
     if (bt == NULL_PTR) {
@@ -283,6 +705,81 @@ u16 Bluetooth_GetAvailableBytes(const BluetoothInterface_t* bt)
     return bt->rx_buffer.count;
 }
 
+u16 Bluetooth_GetFreeSpace(const BluetoothInterface_t* bt)
+{
+    if (bt == NULL_PTR) {
+        return 0U;
+    }
+    
+    if (bt->initialized == false) {
+        return 0U;
+    }
+    
+    return (u16)(BT_RX_BUFFER_SIZE - bt->rx_buffer.count);
+}
+
+bool Bluetooth_IsRxThrottled(const BluetoothInterface_t* bt)
+{
+    if (bt == NULL_PTR) {
+        return false;
+    }
+    
+    return bt->rx_throttled;
+}
+
+u32 Bluetooth_GetDroppedBytes(const BluetoothInterface_t* bt)
+{
+    if (bt == NULL_PTR) {
+        return 0U;
+    }
+    
+    return bt->rx_dropped_bytes;
+}
+
+Result_t Bluetooth_PollRx(BluetoothInterface_t* bt, u64 now_us)
+{
+    if (bt == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (bt->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (bt->rx_notify_pending == 0U) {
+        return RESULT_NO_DATA;
+    }
+    
+    if ((now_us - bt->rx_pending_since_us) < bt->rx_coalesce_us) {
+        return RESULT_BUSY;
+    }
+    
+    flush_rx_notification(bt);
+    
+    return RESULT_OK;
+}
+
+Result_t Bluetooth_GetNotifyStats(const BluetoothInterface_t* bt, u32* chunks, u32* notifications)
+{
+    if (bt == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (bt->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (chunks != NULL_PTR) {
+        *chunks = bt->rx_chunk_count;
+    }
+    
+    if (notifications != NULL_PTR) {
+        *notifications = bt->rx_notify_count;
+    }
+    
+    return RESULT_OK;
+}
+
 BluetoothState_t Bluetooth_GetState(const BluetoothInterface_t* bt)
 {
     if (bt == NULL_PTR) {
@@ -334,6 +831,35 @@ Result_t Bluetooth_GetConnectedDevice(const BluetoothInterface_t* bt, BluetoothD
 }
 
 Result_t Bluetooth_OnDataReceived(BluetoothInterface_t* bt, const u8* data, u16 length)
+{
+    u64 arrival_us = (bt != NULL_PTR) ? Clock_SampleUs(bt->clock) : 0U;
+    
+    return Bluetooth_OnDataReceivedAt(bt, data, length, arrival_us);
+}
+
+Result_t Bluetooth_OnDataReceivedAt(BluetoothInterface_t* bt, const u8* data, u16 length, u64 arrival_us)
+{
+    u16 accepted = 0U;
+    Result_t result = Bluetooth_OnDataReceivedPartial(bt, data, length, arrival_us, &accepted);
+    
+    if ((result != RESULT_OK) || (accepted == length)) {
+        return result;
+    }
+    
+    bt->rx_dropped_bytes += (u32)(length - accepted);
+    
+    if (bt->error_handler != NULL_PTR) {
+        ERROR_REPORT(bt->error_handler, ERR_COMM_BUFFER_OVERFLOW, ERR_SEV_WARNING);
+    }
+    
+    return RESULT_BUFFER_FULL;
+}
+
+Result_t Bluetooth_OnDataReceivedPartial(BluetoothInterface_t* bt,
+                                         const u8* data,
+                                         u16 length,
+                                         u64 arrival_us,
+                                         u16* accepted)
 {
     if (bt == NULL_PTR) {
         return RESULT_INVALID_PARAM;
@@ -343,21 +869,47 @@ Result_t Bluetooth_OnDataReceived(BluetoothInterface_t* bt, const u8* data, u16
         return RESULT_INVALID_PARAM;
     }
     
+    if (accepted == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
     if (bt->initialized == false) {
         return RESULT_NOT_READY;
     }
     
-    for (u16 i = 0U; i < length; i++) {
-        if (rx_buffer_push(&bt->rx_buffer, data[i]) == false) {
-            if (bt->error_handler != NULL_PTR) {
-                ERROR_REPORT(bt->error_handler, ERR_COMM_BUFFER_OVERFLOW, ERR_SEV_WARNING);
-            }
-            return RESULT_BUFFER_FULL;
+    *accepted = 0U;
+    
+    if (length == 0U) {
+        return RESULT_OK;
+    }
+    
+    if (bt->rx_buffer.count < BT_RX_BUFFER_SIZE) {
+        rx_timing_stamp(&bt->rx_timing, arrival_us);
+    }
+    
+    u16 count = rx_buffer_write(&bt->rx_buffer, data, length);
+    bt->rx_timing.write_offset += count;
+    *accepted = count;
+    
+    if (count > 0U) {
+        if (bt->rx_notify_pending == 0U) {
+            bt->rx_pending_since_us = arrival_us;
         }
+        
+        bt->rx_notify_pending += count;
+        bt->rx_chunk_count++;
     }
     
-    if (bt->event_callback != NULL_PTR) {
-        bt->event_callback(BT_EVENT_DATA_RECEIVED, &length, bt->callback_context);
+    if ((bt->rx_throttled == false) && (bt->rx_buffer.count >= bt->rx_high_watermark)) {
+        bt->rx_throttled = true;
+        flush_rx_notification(bt);
+        notify_event(bt, BT_EVENT_RX_HIGH_WATERMARK, &bt->rx_buffer.count);
+    }
+    
+    if ((count > 0U) &&
+        ((memchr(data, BT_RX_PROMPT_CHAR, count) != NULL_PTR) ||
+         ((arrival_us - bt->rx_pending_since_us) >= bt->rx_coalesce_us))) {
+        flush_rx_notification(bt);
     }
     
     return RESULT_OK;
@@ -382,17 +934,22 @@ Result_t Bluetooth_OnStateChanged(BluetoothInterface_t* bt, BluetoothState_t new
     
     if (new_state == BT_STATE_CONNECTED) {
         bt->connected_device.valid = true;
+        bt->scan_active = false;
         
         if (bt->event_callback != NULL_PTR) {
             bt->event_callback(BT_EVENT_CONNECTED, &bt->connected_device, bt->callback_context);
         }
     } else if ((old_state == BT_STATE_CONNECTED) && (new_state != BT_STATE_CONNECTED)) {
         bt->connected_device.valid = false;
-        rx_buffer_init(&bt->rx_buffer);
+        reset_rx(bt);
+        reset_tx(bt);
         
         if (bt->event_callback != NULL_PTR) {
             bt->event_callback(BT_EVENT_DISCONNECTED, NULL_PTR, bt->callback_context);
         }
+    } else if ((old_state == BT_STATE_CONNECTING) && (new_state == BT_STATE_DISCONNECTED) &&
+               (bt->scan_active == true)) {
+        bt->state = BT_STATE_SCANNING;
     }
     
     return RESULT_OK;
@@ -412,13 +969,219 @@ Result_t Bluetooth_OnDeviceFound(BluetoothInterface_t* bt, const BluetoothDevice
         return RESULT_NOT_READY;
     }
     
-    if (bt->event_callback != NULL_PTR) {
-        bt->event_callback(BT_EVENT_DEVICE_FOUND, device, bt->callback_context);
+    i8 smoothed_rssi = device->rssi;
+    bool report = track_found_device(bt, device, &smoothed_rssi);
+    
+    if (bt->adapter_cache != NULL_PTR) {
+        BluetoothAdapterCacheEntry_t* entry = find_adapter_entry(bt->adapter_cache, device->uuid);
+        
+        if (entry != NULL_PTR) {
+            entry->rssi = smoothed_rssi;
+        }
     }
     
+    if (report == false) {
+        bt->duplicate_found_count++;
+        return RESULT_OK;
+    }
+    
+    BluetoothDevice_t reported = *device;
+    reported.rssi = smoothed_rssi;
+    
+    notify_event(bt, BT_EVENT_DEVICE_FOUND, &reported);
+    
     return RESULT_OK;
 }
 
+Result_t BluetoothAdapterCache_Init(BluetoothAdapterCache_t* cache)
+{
+    if (cache == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    for (u8 i = 0U; i < BT_ADAPTER_CACHE_SIZE; i++) {
+        cache->entries[i].uuid[0] = '\0';
+        cache->entries[i].name[0] = '\0';
+        cache->entries[i].rssi = 0;
+        cache->entries[i].is_elm327 = false;
+        cache->entries[i].params_valid = false;
+        cache->entries[i].connect_count = 0U;
+        cache->entries[i].last_used = 0U;
+        cache->entries[i].valid = false;
+    }
+    
+    cache->use_counter = 0U;
+    
+    return RESULT_OK;
+}
+
+Result_t Bluetooth_SetAdapterCache(BluetoothInterface_t* bt, BluetoothAdapterCache_t* cache)
+{
+    if (bt == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (bt->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    bt->adapter_cache = cache;
+    
+    return RESULT_OK;
+}
+
+Result_t Bluetooth_SaveAdapter(BluetoothInterface_t* bt, const BluetoothAdapterParams_t* params)
+{
+    if (bt == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (bt->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if ((bt->adapter_cache == NULL_PTR) || (bt->connected_device.valid == false)) {
+        return RESULT_NOT_READY;
+    }
+    
+    BluetoothAdapterCache_t* cache = bt->adapter_cache;
+    BluetoothAdapterCacheEntry_t* slot = find_adapter_entry(cache, bt->connected_device.uuid);
+    
+    if (slot == NULL_PTR) {
+        slot = &cache->entries[0];
+        
+        for (u8 i = 0U; i < BT_ADAPTER_CACHE_SIZE; i++) {
+            if (cache->entries[i].valid == false) {
+                slot = &cache->entries[i];
+                break;
+            }
+            
+            if (cache->entries[i].last_used < slot->last_used) {
+                slot = &cache->entries[i];
+            }
+        }
+        
+        copy_string_safe(slot->uuid, bt->connected_device.uuid, BT_UUID_STRING_MAX);
+        slot->connect_count = 0U;
+        slot->params_valid = false;
+    }
+    
+    copy_string_safe(slot->name, bt->connected_device.name, BT_DEVICE_NAME_MAX);
+    slot->rssi = bt->connected_device.rssi;
+    slot->is_elm327 = bt->connected_device.is_elm327;
+    
+    if (params != NULL_PTR) {
+        slot->params = *params;
+        slot->params_valid = true;
+    }
+    
+    cache->use_counter++;
+    slot->last_used = cache->use_counter;
+    slot->connect_count++;
+    slot->valid = true;
+    
+    return RESULT_OK;
+}
+
+Result_t Bluetooth_GetPreferredAdapter(const BluetoothInterface_t* bt,
+                                       BluetoothDevice_t* device,
+                                       BluetoothAdapterParams_t* params)
+{
+    if (bt == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (device == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    if (bt->initialized == false) {
+        return RESULT_NOT_READY;
+    }
+    
+    if (bt->adapter_cache == NULL_PTR) {
+        return RESULT_NOT_READY;
+    }
+    
+    const BluetoothAdapterCacheEntry_t* best = NULL_PTR;
+    
+    for (u8 i = 0U; i < BT_ADAPTER_CACHE_SIZE; i++) {
+        const BluetoothAdapterCacheEntry_t* entry = &bt->adapter_cache->entries[i];
+        
+        if ((entry->valid == false) || (entry->is_elm327 == false)) {
+            continue;
+        }
+        
+        if ((best == NULL_PTR) || (entry->last_used > best->last_used)) {
+            best = entry;
+        }
+    }
+    
+    if (best == NULL_PTR) {
+        return RESULT_NO_DATA;
+    }
+    
+    copy_string_safe(device->name, best->name, BT_DEVICE_NAME_MAX);
+    copy_string_safe(device->uuid, best->uuid, BT_UUID_STRING_MAX);
+    device->rssi = best->rssi;
+    device->is_elm327 = best->is_elm327;
+    device->valid = true;
+    
+    if (params != NULL_PTR) {
+        if (best->params_valid == true) {
+            *params = best->params;
+        } else {
+            params->protocol = 0U;
+            params->adaptive_timing = 0U;
+            params->response_timeout = 0U;
+            params->att_mtu = BT_ATT_DEFAULT_MTU;
+            params->write_type = BT_WRITE_WITH_RESPONSE;
+        }
+    }
+    
+    return RESULT_OK;
+}
+
+Result_t Bluetooth_FastReconnect(BluetoothInterface_t* bt, BluetoothAdapterParams_t* params)
+{
+    if (bt == NULL_PTR) {
+        return RESULT_INVALID_PARAM;
+    }
+    
+    BluetoothDevice_t device;
+    Result_t result = Bluetooth_GetPreferredAdapter(bt, &device, params);
+    
+    if (result != RESULT_OK) {
+        return result;
+    }
+    
+    result = Bluetooth_Connect(bt, &device);
+    
+    if (result != RESULT_OK) {
+        return result;
+    }
+    
+    return Bluetooth_StartScan(bt);
+}
+
+bool Bluetooth_IsScanActive(const BluetoothInterface_t* bt)
+{
+    if (bt == NULL_PTR) {
+        return false;
+    }
+    
+    return bt->scan_active;
+}
+
+u32 Bluetooth_GetDuplicateFoundCount(const BluetoothInterface_t* bt)
+{
+    if (bt == NULL_PTR) {
+        return 0U;
+    }
+    
+    return bt->duplicate_found_count;
+}
+
 void Bluetooth_SetPlatformHandle(BluetoothInterface_t* bt, void* handle)
 {
     if (bt != NULL_PTR) {
@@ -3,11 +3,40 @@
 
 #include "../core/types.h"
 #include "../core/error/error_handler.h"
+#include "../core/clock/clock.h"
 
+#ifndef BT_RX_BUFFER_SIZE
 #define BT_RX_BUFFER_SIZE 512
+#endif
+
+#if (BT_RX_BUFFER_SIZE > 0xFFFF)
+#error "BT_RX_BUFFER_SIZE must fit in u16"
+#endif
+
+#ifndef BT_RX_HIGH_WATERMARK
+#define BT_RX_HIGH_WATERMARK ((BT_RX_BUFFER_SIZE * 3) / 4)
+#endif
+
+#ifndef BT_RX_LOW_WATERMARK
+#define BT_RX_LOW_WATERMARK (BT_RX_BUFFER_SIZE / 4)
+#endif
+
 #define BT_TX_BUFFER_SIZE 256
 #define BT_DEVICE_NAME_MAX 64
 #define BT_UUID_STRING_MAX 48
+#define BT_RX_PROMPT_CHAR '>'
+#define BT_RX_COALESCE_DEFAULT_US 15000
+#define BT_ATT_HEADER_SIZE 3
+#define BT_ATT_DEFAULT_MTU 23
+#define BT_TX_DEFAULT_CREDITS 4
+#define BT_ADAPTER_CACHE_SIZE 4
+#define BT_SEEN_DEVICES_MAX 16
+#define BT_RSSI_SMOOTHING_SHIFT 2
+#define BT_RSSI_REPORT_DELTA 6
+
+#ifndef BT_RX_STAMP_DEPTH
+#define BT_RX_STAMP_DEPTH ((BT_RX_BUFFER_SIZE / (BT_ATT_DEFAULT_MTU - BT_ATT_HEADER_SIZE)) + 1)
+#endif
 
 typedef enum {
     BT_STATE_DISABLED = 0,
@@ -29,9 +58,17 @@ typedef enum {
     BT_EVENT_DATA_RECEIVED = 6,
     BT_EVENT_WRITE_COMPLETE = 7,
     BT_EVENT_ERROR = 8,
+    BT_EVENT_RX_HIGH_WATERMARK = 9,
+    BT_EVENT_RX_LOW_WATERMARK = 10,
     BT_EVENT_MAX
 } BluetoothEvent_t;
 
+typedef enum {
+    BT_WRITE_WITH_RESPONSE = 0,
+    BT_WRITE_WITHOUT_RESPONSE = 1,
+    BT_WRITE_TYPE_MAX
+} BluetoothWriteType_t;
+
 typedef struct {
     char name[BT_DEVICE_NAME_MAX];
     char uuid[BT_UUID_STRING_MAX];
@@ -40,6 +77,40 @@ typedef struct {
     bool valid;
 } BluetoothDevice_t;
 
+typedef struct {
+    u8 protocol;
+    u8 adaptive_timing;
+    u8 response_timeout;
+    u16 att_mtu;
+    BluetoothWriteType_t write_type;
+} BluetoothAdapterParams_t;
+
+typedef struct {
+    char uuid[BT_UUID_STRING_MAX];
+    char name[BT_DEVICE_NAME_MAX];
+    i8 rssi;
+    bool is_elm327;
+    BluetoothAdapterParams_t params;
+    bool params_valid;
+    u32 connect_count;
+    u32 last_used;
+    bool valid;
+} BluetoothAdapterCacheEntry_t;
+
+typedef struct {
+    BluetoothAdapterCacheEntry_t entries[BT_ADAPTER_CACHE_SIZE];
+    u32 use_counter;
+} BluetoothAdapterCache_t;
+
+typedef struct {
+    u32 uuid_hash;
+    u32 name_hash;
+    i16 rssi_q;
+    i8 reported_rssi;
+    bool is_elm327;
+    bool valid;
+} BluetoothSeenDevice_t;
+
 typedef struct {
     u8 buffer[BT_RX_BUFFER_SIZE];
     u16 head;
@@ -47,24 +118,68 @@ typedef struct {
     u16 count;
 } BluetoothRxBuffer_t;
 
+typedef struct {
+    u32 stream_offset;
+    u64 arrival_us;
+} BluetoothRxStamp_t;
+
+typedef struct {
+    BluetoothRxStamp_t stamps[BT_RX_STAMP_DEPTH];
+    u16 head;
+    u16 count;
+    u32 write_offset;
+    u32 read_offset;
+} BluetoothRxTiming_t;
+
 typedef void (*BluetoothEventCallback_t)(BluetoothEvent_t event, const void* data, void* context);
+typedef Result_t (*BluetoothTransmitCallback_t)(const u8* data, u16 length, BluetoothWriteType_t write_type, void* context);
 
 typedef struct {
     BluetoothEventCallback_t event_callback;
     void* callback_context;
     ErrorHandler_t* error_handler;
+    const Clock_t* clock;
+    u16 rx_high_watermark;
+    u16 rx_low_watermark;
+    u32 rx_coalesce_us;
+    BluetoothTransmitCallback_t transmit_callback;
 } BluetoothConfig_t;
 
 typedef struct {
     BluetoothState_t state;
     BluetoothDevice_t connected_device;
     BluetoothRxBuffer_t rx_buffer;
+    BluetoothRxTiming_t rx_timing;
+    u16 rx_high_watermark;
+    u16 rx_low_watermark;
+    bool rx_throttled;
+    u32 rx_dropped_bytes;
+    u32 rx_coalesce_us;
+    u32 rx_notify_pending;
+    u64 rx_pending_since_us;
+    u32 rx_chunk_count;
+    u32 rx_notify_count;
     u8 tx_buffer[BT_TX_BUFFER_SIZE];
     u16 tx_pending;
+    u16 tx_sent;
+    u16 tx_chunk_size;
+    BluetoothWriteType_t tx_write_type;
+    u8 tx_credits;
+    u8 tx_max_credits;
+    bool tx_awaiting_response;
+    u32 tx_chunk_count;
+    BluetoothTransmitCallback_t transmit_callback;
+    u64 last_tx_us;
+    bool scan_active;
+    BluetoothSeenDevice_t seen_devices[BT_SEEN_DEVICES_MAX];
+    u8 seen_next;
+    u32 duplicate_found_count;
+    BluetoothAdapterCache_t* adapter_cache;
     bool initialized;
     BluetoothEventCallback_t event_callback;
     void* callback_context;
     ErrorHandler_t* error_handler;
+    const Clock_t* clock;
     void* platform_handle;
 } BluetoothInterface_t;
 
@@ -82,10 +197,45 @@ Result_t Bluetooth_Disconnect(BluetoothInterface_t* bt);
 
 Result_t Bluetooth_Write(BluetoothInterface_t* bt, const u8* data, u16 length);
 
+Result_t Bluetooth_SetLinkParameters(BluetoothInterface_t* bt,
+                                     u16 att_mtu,
+                                     BluetoothWriteType_t write_type,
+                                     u8 max_credits);
+
+Result_t Bluetooth_OnTxReady(BluetoothInterface_t* bt, u8 credits);
+
+Result_t Bluetooth_OnWriteComplete(BluetoothInterface_t* bt, Result_t result);
+
+u16 Bluetooth_GetTxChunkSize(const BluetoothInterface_t* bt);
+
+u32 Bluetooth_GetTxChunkCount(const BluetoothInterface_t* bt);
+
 Result_t Bluetooth_Read(BluetoothInterface_t* bt, u8* buffer, u16 max_length, u16* actual_length);
 
+Result_t Bluetooth_ReadTimed(BluetoothInterface_t* bt,
+                             u8* buffer,
+                             u16 max_length,
+                             u16* actual_length,
+                             u64* first_arrival_us);
+
+Result_t Bluetooth_GetArrivalTime(const BluetoothInterface_t* bt, u32 stream_offset, u64* arrival_us);
+
+u32 Bluetooth_GetReadOffset(const BluetoothInterface_t* bt);
+
+u64 Bluetooth_GetLastWriteTime(const BluetoothInterface_t* bt);
+
 u16 Bluetooth_GetAvailableBytes(const BluetoothInterface_t* bt);
 
+u16 Bluetooth_GetFreeSpace(const BluetoothInterface_t* bt);
+
+bool Bluetooth_IsRxThrottled(const BluetoothInterface_t* bt);
+
+u32 Bluetooth_GetDroppedBytes(const BluetoothInterface_t* bt);
+
+Result_t Bluetooth_PollRx(BluetoothInterface_t* bt, u64 now_us);
+
+Result_t Bluetooth_GetNotifyStats(const BluetoothInterface_t* bt, u32* chunks, u32* notifications);
+
 BluetoothState_t Bluetooth_GetState(const BluetoothInterface_t* bt);
 
 bool Bluetooth_IsConnected(const BluetoothInterface_t* bt);
@@ -94,10 +244,34 @@ Result_t Bluetooth_GetConnectedDevice(const BluetoothInterface_t* bt, BluetoothD
 
 Result_t Bluetooth_OnDataReceived(BluetoothInterface_t* bt, const u8* data, u16 length);
 
+Result_t Bluetooth_OnDataReceivedAt(BluetoothInterface_t* bt, const u8* data, u16 length, u64 arrival_us);
+
+Result_t Bluetooth_OnDataReceivedPartial(BluetoothInterface_t* bt,
+                                         const u8* data,
+                                         u16 length,
+                                         u64 arrival_us,
+                                         u16* accepted);
+
 Result_t Bluetooth_OnStateChanged(BluetoothInterface_t* bt, BluetoothState_t new_state);
 
 Result_t Bluetooth_OnDeviceFound(BluetoothInterface_t* bt, const BluetoothDevice_t* device);
 
+Result_t BluetoothAdapterCache_Init(BluetoothAdapterCache_t* cache);
+
+Result_t Bluetooth_SetAdapterCache(BluetoothInterface_t* bt, BluetoothAdapterCache_t* cache);
+
+Result_t Bluetooth_SaveAdapter(BluetoothInterface_t* bt, const BluetoothAdapterParams_t* params);
+
+Result_t Bluetooth_GetPreferredAdapter(const BluetoothInterface_t* bt,
+                                       BluetoothDevice_t* device,
+                                       BluetoothAdapterParams_t* params);
+
+Result_t Bluetooth_FastReconnect(BluetoothInterface_t* bt, BluetoothAdapterParams_t* params);
+
+bool Bluetooth_IsScanActive(const BluetoothInterface_t* bt);
+
+u32 Bluetooth_GetDuplicateFoundCount(const BluetoothInterface_t* bt);
+
 void Bluetooth_SetPlatformHandle(BluetoothInterface_t* bt, void* handle);
 
 void* Bluetooth_GetPlatformHandle(const BluetoothInterface_t* bt);
@@ -0,0 +1,365 @@
+#include "../../core/pid_pack/pid_pack.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GEN_MAX_RECORDS 4096U
+#define GEN_MAX_STRINGS 65535U
+#define GEN_LINE_LENGTH 256U
+#define GEN_KEYS_PER_BUCKET 4U
+#define GEN_FIELD_COUNT 14U
+
+typedef struct {
+    u32 key;
+    u16 name_offset;
+    u16 short_name_offset;
+    u8 unit;
+    u8 data_type;
+    u8 data_bytes;
+    u8 priority;
+    u16 scale_num;
+    u16 scale_den;
+    i32 offset;
+    float min_value;
+    float max_value;
+    u16 default_rate_ms;
+    u16 bucket;
+} GenRecord_t;
+
+static GenRecord_t records[GEN_MAX_RECORDS];
+static u16 record_count;
+static char strings[GEN_MAX_STRINGS];
+static u32 string_size;
+
+static u16 bucket_sizes[GEN_MAX_RECORDS];
+static u16 bucket_order[GEN_MAX_RECORDS];
+static u16 displacements[GEN_MAX_RECORDS];
+static i32 slot_owner[GEN_MAX_RECORDS];
+
+static void put_u16(u8* out, u16 value)
+{
+    out[0] = (u8)(value & 0xFFU);
+    out[1] = (u8)(value >> 8U);
+}
+
+static void put_u32(u8* out, u32 value)
+{
+    out[0] = (u8)(value & 0xFFU);
+    out[1] = (u8)((value >> 8U) & 0xFFU);
+    out[2] = (u8)((value >> 16U) & 0xFFU);
+    out[3] = (u8)(value >> 24U);
+}
+
+static void put_float(u8* out, float value)
+{
+    u32 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    put_u32(out, bits);
+}
+
+static bool add_string(const char* text, u16* offset)
+{
+    size_t length = strlen(text) + 1U;
+    
+    if ((string_size + length) > GEN_MAX_STRINGS) {
+        return false;
+    }
+    
+    memcpy(&strings[string_size], text, length);
+    *offset = (u16)string_size;
+    string_size += (u32)length;
+    return true;
+}
+
+static char* trim(char* text)
+{
+    while ((*text == ' ') || (*text == '\t')) {
+        text++;
+    }
+    
+    size_t length = strlen(text);
+    while ((length > 0U) &&
+           ((text[length - 1U] == ' ') || (text[length - 1U] == '\t') ||
+            (text[length - 1U] == '\r') || (text[length - 1U] == '\n'))) {
+        text[length - 1U] = '\0';
+        length--;
+    }
+    
+    return text;
+}
+
+static bool parse_line(char* line, GenRecord_t* record)
+{
+    char* fields[GEN_FIELD_COUNT];
+    u32 count = 0U;
+    char* cursor = line;
+    
+    while (count < GEN_FIELD_COUNT) {
+        char* comma = strchr(cursor, ',');
+        
+        if (comma != NULL_PTR) {
+            *comma = '\0';
+        }
+        
+        fields[count] = trim(cursor);
+        count++;
+        
+        if (comma == NULL_PTR) {
+            break;
+        }
+        
+        cursor = comma + 1;
+    }
+    
+    if (count != GEN_FIELD_COUNT) {
+        return false;
+    }
+    
+    u32 mode = (u32)strtoul(fields[0], NULL_PTR, 0);
+    u32 did = (u32)strtoul(fields[1], NULL_PTR, 0);
+    u32 scale_den = (u32)strtoul(fields[9], NULL_PTR, 0);
+    
+    if ((mode > 0xFFU) || (did > 0xFFFFU) || (scale_den == 0U) || (scale_den > 0xFFFFU)) {
+        return false;
+    }
+    
+    record->key = PID_PACK_KEY(mode, did);
+    record->unit = (u8)strtoul(fields[4], NULL_PTR, 0);
+    record->data_type = (u8)strtoul(fields[5], NULL_PTR, 0);
+    record->data_bytes = (u8)strtoul(fields[6], NULL_PTR, 0);
+    record->priority = (u8)strtoul(fields[7], NULL_PTR, 0);
+    record->scale_num = (u16)strtoul(fields[8], NULL_PTR, 0);
+    record->scale_den = (u16)scale_den;
+    record->offset = (i32)strtol(fields[10], NULL_PTR, 0);
+    record->min_value = strtof(fields[11], NULL_PTR);
+    record->max_value = strtof(fields[12], NULL_PTR);
+    record->default_rate_ms = (u16)strtoul(fields[13], NULL_PTR, 0);
+    
+    if (add_string(fields[2], &record->name_offset) == false) {
+        return false;
+    }
+    
+    return add_string(fields[3], &record->short_name_offset);
+}
+
+static bool read_definitions(const char* path)
+{
+    FILE* file = fopen(path, "r");
+    
+    if (file == NULL_PTR) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+    
+    char line[GEN_LINE_LENGTH];
+    u32 line_number = 0U;
+    bool ok = true;
+    
+    while ((ok == true) && (fgets(line, (int)sizeof(line), file) != NULL_PTR)) {
+        line_number++;
+        char* text = trim(line);
+        
+        if ((text[0] == '\0') || (text[0] == '#')) {
+            continue;
+        }
+        
+        if (record_count >= GEN_MAX_RECORDS) {
+            fprintf(stderr, "%s:%u: too many definitions\n", path, line_number);
+            ok = false;
+        } else if (parse_line(text, &records[record_count]) == false) {
+            fprintf(stderr, "%s:%u: malformed definition\n", path, line_number);
+            ok = false;
+        } else {
+            for (u16 i = 0U; i < record_count; i++) {
+                if (records[i].key == records[record_count].key) {
+                    fprintf(stderr, "%s:%u: duplicate definition\n", path, line_number);
+                    ok = false;
+                }
+            }
+            record_count++;
+        }
+    }
+    
+    fclose(file);
+    return ok;
+}
+
+static int compare_buckets(const void* a, const void* b)
+{
+    u16 size_a = bucket_sizes[*(const u16*)a];
+    u16 size_b = bucket_sizes[*(const u16*)b];
+    return (int)size_b - (int)size_a;
+}
+
+static bool try_displacement(u16 bucket, u16 displacement, u16* slots)
+{
+    u16 placed = 0U;
+    
+    for (u16 i = 0U; i < record_count; i++) {
+        if (records[i].bucket != bucket) {
+            continue;
+        }
+        
+        u16 slot = (u16)(PidPack_Hash(records[i].key, (u32)displacement + 1U) % record_count);
+        
+        if (slot_owner[slot] >= 0) {
+            return false;
+        }
+        
+        for (u16 p = 0U; p < placed; p++) {
+            if (slots[p] == slot) {
+                return false;
+            }
+        }
+        
+        slots[placed] = slot;
+        placed++;
+    }
+    
+    return true;
+}
+
+static bool build_hash(u16 bucket_count)
+{
+    for (u16 i = 0U; i < bucket_count; i++) {
+        bucket_sizes[i] = 0U;
+        bucket_order[i] = i;
+        displacements[i] = 0U;
+    }
+    
+    for (u16 i = 0U; i < record_count; i++) {
+        records[i].bucket = (u16)(PidPack_Hash(records[i].key, 0U) % bucket_count);
+        bucket_sizes[records[i].bucket]++;
+        slot_owner[i] = -1;
+    }
+    
+    qsort(bucket_order, bucket_count, sizeof(bucket_order[0]), compare_buckets);
+    
+    u16 slots[GEN_MAX_RECORDS];
+    
+    for (u16 b = 0U; b < bucket_count; b++) {
+        u16 bucket = bucket_order[b];
+        
+        if (bucket_sizes[bucket] == 0U) {
+            break;
+        }
+        
+        bool placed = false;
+        
+        for (u32 d = 0U; (d <= PID_PACK_MAX_DISPLACEMENT) && (placed == false); d++) {
+            if (try_displacement(bucket, (u16)d, slots) == true) {
+                u16 n = 0U;
+                
+                for (u16 i = 0U; i < record_count; i++) {
+                    if (records[i].bucket == bucket) {
+                        slot_owner[slots[n]] = (i32)i;
+                        n++;
+                    }
+                }
+                
+                displacements[bucket] = (u16)d;
+                placed = true;
+            }
+        }
+        
+        if (placed == false) {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+static bool write_pack(const char* path, u16 bucket_count)
+{
+    u32 displacement_offset = PID_PACK_HEADER_SIZE;
+    u32 record_offset = displacement_offset + ((u32)bucket_count * 2U);
+    record_offset = (record_offset + 3U) & ~3U;
+    u32 string_offset = record_offset + ((u32)record_count * PID_PACK_RECORD_SIZE);
+    u32 total_size = string_offset + string_size;
+    
+    u8* image = calloc(total_size, 1U);
+    
+    if (image == NULL_PTR) {
+        return false;
+    }
+    
+    put_u32(&image[0], PID_PACK_MAGIC);
+    put_u16(&image[4], PID_PACK_VERSION);
+    put_u16(&image[6], PID_PACK_HEADER_SIZE);
+    put_u16(&image[8], record_count);
+    put_u16(&image[10], bucket_count);
+    put_u32(&image[12], displacement_offset);
+    put_u32(&image[16], record_offset);
+    put_u32(&image[20], string_offset);
+    put_u32(&image[24], string_size);
+    put_u32(&image[28], total_size);
+    
+    for (u16 i = 0U; i < bucket_count; i++) {
+        put_u16(&image[displacement_offset + ((u32)i * 2U)], displacements[i]);
+    }
+    
+    for (u16 slot = 0U; slot < record_count; slot++) {
+        const GenRecord_t* record = &records[slot_owner[slot]];
+        u8* out = &image[record_offset + ((u32)slot * PID_PACK_RECORD_SIZE)];
+        
+        put_u32(&out[0], record->key);
+        put_u16(&out[4], record->name_offset);
+        put_u16(&out[6], record->short_name_offset);
+        out[8] = record->unit;
+        out[9] = record->data_type;
+        out[10] = record->data_bytes;
+        out[11] = record->priority;
+        put_u16(&out[12], record->scale_num);
+        put_u16(&out[14], record->scale_den);
+        put_u32(&out[16], (u32)record->offset);
+        put_float(&out[20], record->min_value);
+        put_float(&out[24], record->max_value);
+        put_u16(&out[28], record->default_rate_ms);
+    }
+    
+    memcpy(&image[string_offset], strings, string_size);
+    
+    FILE* file = fopen(path, "wb");
+    bool ok = false;
+    
+    if (file != NULL_PTR) {
+        ok = (fwrite(image, 1U, total_size, file) == total_size);
+        fclose(file);
+    }
+    
+    free(image);
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <definitions.csv> <pack.bin>\n", argv[0]);
+        return 1;
+    }
+    
+    if (read_definitions(argv[1]) == false) {
+        return 1;
+    }
+    
+    if (record_count == 0U) {
+        fprintf(stderr, "no definitions in %s\n", argv[1]);
+        return 1;
+    }
+    
+    u16 bucket_count = (u16)((record_count + GEN_KEYS_PER_BUCKET - 1U) / GEN_KEYS_PER_BUCKET);
+    
+    if (build_hash(bucket_count) == false) {
+        fprintf(stderr, "failed to build perfect hash\n");
+        return 1;
+    }
+    
+    if (write_pack(argv[2], bucket_count) == false) {
+        fprintf(stderr, "cannot write %s\n", argv[2]);
+        return 1;
+    }
+    
+    printf("%u definitions, %u buckets, %u string bytes\n", record_count, bucket_count, string_size);
+    return 0;
+}